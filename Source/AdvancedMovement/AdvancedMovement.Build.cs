@@ -1,5 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+using System.Collections.Generic;
+using System.Linq;
+using EpicGames.Core;
 using UnrealBuildTool;
 
 public class AdvancedMovement : ModuleRules
@@ -25,7 +28,7 @@ public class AdvancedMovement : ModuleRules
 		PublicDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"Core", "Engine",
+				"Core", "Engine", "DeveloperSettings", "GameplayTags",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -36,12 +39,24 @@ public class AdvancedMovement : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"Chaos",
+				"PhysicsCore",
 				"Slate",
-				"SlateCore",
-				"AdvancedLogger"
+				"SlateCore"
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
+
+		// AdvancedLogger is optional, and never linked where ADVANCEDMOVEMENT_WITH_LOGGING strips logging
+		bool bStripLogging = Target.Type == TargetType.Server &&
+			(Target.Configuration == UnrealTargetConfiguration.Shipping ||
+			 Target.Configuration == UnrealTargetConfiguration.Test);
+		bool bWithAdvancedLogger = !bStripLogging && IsPluginEnabled(Target, "AdvancedLogger");
+		if (bWithAdvancedLogger)
+		{
+			PrivateDependencyModuleNames.Add("AdvancedLogger");
+		}
+		PrivateDefinitions.Add("ADVANCEDMOVEMENT_WITH_ADVANCED_LOGGER=" + (bWithAdvancedLogger ? "1" : "0"));
 		
 		
 		DynamicallyLoadedModuleNames.AddRange(
@@ -50,5 +65,42 @@ public class AdvancedMovement : ModuleRules
 				// ... add any modules that your module loads dynamically here ...
 			}
 			);
+
+		SetupGameplayDebuggerSupport(Target);
+	}
+
+	/// <summary>
+	/// Checks if a plugin exists and is enabled for the target, either by the project, the target or the
+	/// plugin references of this plugin.
+	/// </summary>
+	private bool IsPluginEnabled(ReadOnlyTargetRules Target, string PluginName)
+	{
+		DirectoryReference ProjectDirectory = Target.ProjectFile != null ? Target.ProjectFile.Directory : null;
+		if (!Plugins.ReadAvailablePlugins(Unreal.EngineDirectory, ProjectDirectory, null)
+			    .Any(Available => Available.Name == PluginName) ||
+		    Target.DisablePlugins.Contains(PluginName))
+		{
+			return false;
+		}
+		if (Target.EnablePlugins.Contains(PluginName))
+		{
+			return true;
+		}
+
+		// An explicit project reference wins over the reference of this plugin
+		IEnumerable<PluginReferenceDescriptor> ProjectReferences = Target.ProjectFile != null
+			? ProjectDescriptor.FromFile(Target.ProjectFile).Plugins ?? Enumerable.Empty<PluginReferenceDescriptor>()
+			: Enumerable.Empty<PluginReferenceDescriptor>();
+		PluginReferenceDescriptor Reference = ProjectReferences.FirstOrDefault(Project => Project.Name == PluginName);
+		if (Reference == null && Plugin != null && Plugin.Descriptor.Plugins != null)
+		{
+			Reference = Plugin.Descriptor.Plugins.FirstOrDefault(Own => Own.Name == PluginName);
+		}
+
+		return Reference != null &&
+		       Reference.bEnabled &&
+		       Reference.IsEnabledForPlatform(Target.Platform) &&
+		       Reference.IsEnabledForTargetConfiguration(Target.Configuration) &&
+		       Reference.IsEnabledForTarget(Target.Type);
 	}
 }
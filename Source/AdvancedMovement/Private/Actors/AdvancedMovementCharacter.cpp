@@ -4,6 +4,8 @@
 #include "Actors/AdvancedMovementCharacter.h"
 
 #include "Components/AdvancedMovementComponent.h"
+#include "Net/UnrealNetwork.h"
+#include "Types/AdvancedMovementMemory.h"
 
 
 // Sets default values
@@ -16,11 +18,51 @@ AAdvancedMovementCharacter::AAdvancedMovementCharacter(const FObjectInitializer&
 
 	AdvancedMovementComponent = Cast<UAdvancedMovementComponent>(GetCharacterMovement());
 	AdvancedMovementComponent->SetIsReplicated(true);
-	AdvancedMovementComponent->OnEnteredSlide.AddDynamic(this, &AAdvancedMovementCharacter::OnSlideEnteredHandler);
-	AdvancedMovementComponent->OnLeftSlide.AddDynamic(this, &AAdvancedMovementCharacter::OnSlideLeftHandler);
-	AdvancedMovementComponent->OnDashStarted.AddDynamic(this, &AAdvancedMovementCharacter::OnDashStartedHandler);
 }
 
+void AAdvancedMovementCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	LLM_SCOPE_BYTAG(AdvancedMovement_Delegates);
+	// Native bindings, the dynamic events stay unbound unless Blueprint subscribes to them
+	AdvancedMovementComponent->OnEnteredSlideNative.AddUObject(this, &AAdvancedMovementCharacter::OnSlideEnteredHandler);
+	AdvancedMovementComponent->OnLeftSlideNative.AddUObject(this, &AAdvancedMovementCharacter::OnSlideLeftHandler);
+	AdvancedMovementComponent->OnDashStartedNative.AddUObject(this, &AAdvancedMovementCharacter::OnDashStartedHandler);
+
+	if (HasAuthority())
+	{
+		RefreshAbilityGates();
+	}
+}
+
+void AAdvancedMovementCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+	DOREPLIFETIME(AAdvancedMovementCharacter, BlockedAbilities);
+}
+
+
+void AAdvancedMovementCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	if (AdvancedMovementComponent)
+	{
+		AdvancedMovementComponent->HandleControllerChanged();
+	}
+}
+
+void AAdvancedMovementCharacter::PawnClientRestart()
+{
+	Super::PawnClientRestart();
+
+	// Possessed on the owning client, allocate saved moves before the first input arrives
+	if (AdvancedMovementComponent)
+	{
+		AdvancedMovementComponent->PrewarmPredictionData();
+	}
+}
 
 void AAdvancedMovementCharacter::OnSlideEnteredHandler(UAdvancedMovementComponent* MovementComponent,
                                                        EMovementMode PrevMode, uint8 PrevCustomMode)
@@ -95,6 +137,7 @@ FVector2D AAdvancedMovementCharacter::CalculatePitchFreeze(float InValue, int De
 
 FCollisionQueryParams AAdvancedMovementCharacter::GetIgnoreCharacterParams() const
 {
+	LLM_SCOPE_BYTAG(AdvancedMovement_QueryParams);
 	FCollisionQueryParams params;
 
 	TArray<AActor*> children;
@@ -104,6 +147,51 @@ FCollisionQueryParams AAdvancedMovementCharacter::GetIgnoreCharacterParams() con
 	return params;
 }
 
+void AAdvancedMovementCharacter::SetAbilityBlocked(EAdvancedMovementAbility InAbility, bool bInBlocked)
+{
+	if (bInBlocked)
+	{
+		ExplicitBlockedAbilities |= static_cast<uint8>(InAbility);
+	}
+	else
+	{
+		ExplicitBlockedAbilities &= ~static_cast<uint8>(InAbility);
+	}
+	BlockedAbilities = ExplicitBlockedAbilities | TagBlockedAbilities | GateBlockedAbilities;
+}
+
+void AAdvancedMovementCharacter::UpdateBlockedAbilitiesFromTags(const FGameplayTagContainer& InOwnedTags)
+{
+	TagBlockedAbilities = 0;
+	if (InOwnedTags.HasAny(SprintBlockingTags))
+	{
+		TagBlockedAbilities |= static_cast<uint8>(EAdvancedMovementAbility::Sprint);
+	}
+	if (InOwnedTags.HasAny(SlideBlockingTags))
+	{
+		TagBlockedAbilities |= static_cast<uint8>(EAdvancedMovementAbility::Slide);
+	}
+	if (InOwnedTags.HasAny(DashBlockingTags))
+	{
+		TagBlockedAbilities |= static_cast<uint8>(EAdvancedMovementAbility::Dash);
+	}
+	BlockedAbilities = ExplicitBlockedAbilities | TagBlockedAbilities | GateBlockedAbilities;
+}
+
+void AAdvancedMovementCharacter::RefreshAbilityGates()
+{
+	GateBlockedAbilities = 0;
+	if (!CanSprint())
+	{
+		GateBlockedAbilities |= static_cast<uint8>(EAdvancedMovementAbility::Sprint);
+	}
+	if (!CanDash())
+	{
+		GateBlockedAbilities |= static_cast<uint8>(EAdvancedMovementAbility::Dash);
+	}
+	BlockedAbilities = ExplicitBlockedAbilities | TagBlockedAbilities | GateBlockedAbilities;
+}
+
 bool AAdvancedMovementCharacter::CanSprint_Implementation()
 {
 	return true;
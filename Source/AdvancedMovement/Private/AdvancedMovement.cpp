@@ -2,6 +2,15 @@
 
 #include "AdvancedMovement.h"
 
+#include "Types/AdvancedMovementLatency.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "Debug/GameplayDebuggerCategory_AdvancedMovement.h"
+
+static const FName GameplayDebuggerCategoryName = TEXT("AdvancedMovement");
+#endif
+
 DEFINE_LOG_CATEGORY(LogAdvancedMovement);
 
 #define LOCTEXT_NAMESPACE "FAdvancedMovementModule"
@@ -9,12 +18,44 @@ DEFINE_LOG_CATEGORY(LogAdvancedMovement);
 void FAdvancedMovementModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+#if WITH_GAMEPLAY_DEBUGGER
+	IGameplayDebugger& gameplayDebugger = IGameplayDebugger::Get();
+	gameplayDebugger.RegisterCategory(GameplayDebuggerCategoryName,
+	                                  IGameplayDebugger::FOnGetCategory::CreateStatic(
+		                                  &FGameplayDebuggerCategory_AdvancedMovement::MakeInstance),
+	                                  EGameplayDebuggerCategoryState::EnabledInGameAndSimulate);
+	gameplayDebugger.NotifyCategoriesChanged();
+#endif
+
+#if ADVANCEDMOVEMENT_WITH_LATENCY_STATS
+	CsvProfileStartHandle = FCsvProfiler::Get()->OnCSVProfileStart().AddLambda([]()
+	{
+		FAdvancedMovementLatencyStats::Get().Reset();
+	});
+	CsvProfileEndHandle = FCsvProfiler::Get()->OnCSVProfileEnd().AddLambda([]()
+	{
+		FAdvancedMovementLatencyStats::Get().WriteCsvMetadata();
+	});
+#endif
 }
 
 void FAdvancedMovementModule::ShutdownModule()
 {
+#if ADVANCEDMOVEMENT_WITH_LATENCY_STATS
+	FCsvProfiler::Get()->OnCSVProfileStart().Remove(CsvProfileStartHandle);
+	FCsvProfiler::Get()->OnCSVProfileEnd().Remove(CsvProfileEndHandle);
+#endif
+
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& gameplayDebugger = IGameplayDebugger::Get();
+		gameplayDebugger.UnregisterCategory(GameplayDebuggerCategoryName);
+		gameplayDebugger.NotifyCategoriesChanged();
+	}
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -8,9 +8,19 @@
 #include "AdvancedMovement.h"
 #include "Actors/AdvancedMovementCharacter.h"
 #include "Components/CapsuleComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Data/AdvancedSlideSurfaceTable.h"
 #include "GameFramework/Character.h"
+#include "Misc/EngineVersionComparison.h"
 #include "Net/UnrealNetwork.h"
-#include "Subsystems/LoggerLib.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Settings/AdvancedMovementSettings.h"
+#include "Subsystems/AdvancedMovementAsyncSubsystem.h"
+#include "Subsystems/AdvancedMovementEventSubsystem.h"
+#include "Subsystems/AdvancedMovementHistorySubsystem.h"
+#include "Subsystems/AdvancedMovementSignificanceSubsystem.h"
+#include "Subsystems/AdvancedMovementTickSubsystem.h"
+#include "Types/AdvancedMovementMemory.h"
 
 UAdvancedMovementComponent::FSavedMove_Advanced::FSavedMove_Advanced()
 {
@@ -18,6 +28,10 @@ UAdvancedMovementComponent::FSavedMove_Advanced::FSavedMove_Advanced()
 	Saved_bWantsToSlide = 0;
 	Saved_bPrevWantsToCrouch = 0;
 	Saved_bWantsToDash = 0;
+	Saved_Stamina = 0.f;
+	Saved_DashCooldownRemaining = 0.f;
+	Saved_SprintTime = 0.f;
+	Saved_SlideTime = 0.f;
 }
 
 bool UAdvancedMovementComponent::FSavedMove_Advanced::CanCombineWith(const FSavedMovePtr& NewMove,
@@ -25,19 +39,62 @@ bool UAdvancedMovementComponent::FSavedMove_Advanced::CanCombineWith(const FSave
                                                                      float MaxDelta) const
 {
 	FSavedMove_Advanced* NewXeusMove = static_cast<FSavedMove_Advanced*>(NewMove.Get());
-	if (Saved_bWantsToSprint != NewXeusMove->Saved_bWantsToSprint)
+	const auto refuse = [&](EAdvancedMovementCombineRefusal InReason)
 	{
+		ADVANCEDMOVEMENT_NET_STAT(
+			static_cast<const UAdvancedMovementComponent*>(InCharacter->GetCharacterMovement())->NetStats.
+			RecordRefusal(InReason));
 		return false;
+	};
+
+	if (Saved_bWantsToSprint != NewXeusMove->Saved_bWantsToSprint)
+	{
+		return refuse(EAdvancedMovementCombineRefusal::Sprint);
 	}
 	if (Saved_bWantsToSlide != NewXeusMove->Saved_bWantsToSlide)
 	{
-		return false;
+		return refuse(EAdvancedMovementCombineRefusal::Slide);
 	}
 	if (Saved_bWantsToDash != NewXeusMove->Saved_bWantsToDash)
 	{
-		return false;
+		return refuse(EAdvancedMovementCombineRefusal::Dash);
+	}
+	// Running out of stamina stops the sprint, keep it on a move boundary
+	if ((Saved_Stamina <= 0.f) != (NewXeusMove->Saved_Stamina <= 0.f))
+	{
+		return refuse(EAdvancedMovementCombineRefusal::Stamina);
+	}
+	// A buffered dash fires on the move its cooldown ends, which a combined move would shift
+	if (Saved_bWantsToDash && Saved_DashCooldownRemaining > 0.f)
+	{
+		return refuse(EAdvancedMovementCombineRefusal::DashCooldown);
 	}
-	return FSavedMove_Character::CanCombineWith(NewMove, InCharacter, MaxDelta);
+	if (!FSavedMove_Character::CanCombineWith(NewMove, InCharacter, MaxDelta))
+	{
+		return refuse(EAdvancedMovementCombineRefusal::Base);
+	}
+	return true;
+}
+
+void UAdvancedMovementComponent::FSavedMove_Advanced::CombineWith(const FSavedMove_Character* OldMove,
+                                                                  ACharacter* InCharacter, APlayerController* PC,
+                                                                  const FVector& OldStartLocation)
+{
+	FSavedMove_Character::CombineWith(OldMove, InCharacter, PC, OldStartLocation);
+
+	// The combined move is simulated again from the start of the pending move, so is its predicted state
+	UAdvancedMovementComponent* movement = static_cast<UAdvancedMovementComponent*>(InCharacter->GetCharacterMovement());
+	const FSavedMove_Advanced* oldMove = static_cast<const FSavedMove_Advanced*>(OldMove);
+	movement->Safe_Stamina = oldMove->Saved_Stamina;
+	Saved_Stamina = oldMove->Saved_Stamina;
+	movement->Safe_DashCooldownRemaining = oldMove->Saved_DashCooldownRemaining;
+	Saved_DashCooldownRemaining = oldMove->Saved_DashCooldownRemaining;
+	movement->Safe_SprintTime = oldMove->Saved_SprintTime;
+	Saved_SprintTime = oldMove->Saved_SprintTime;
+	movement->Safe_SlideTime = oldMove->Saved_SlideTime;
+	Saved_SlideTime = oldMove->Saved_SlideTime;
+
+	ADVANCEDMOVEMENT_NET_STAT(movement->NetStats.RecordCombined());
 }
 
 void UAdvancedMovementComponent::FSavedMove_Advanced::Clear()
@@ -49,6 +106,12 @@ void UAdvancedMovementComponent::FSavedMove_Advanced::Clear()
 	Saved_bWantsToDash = 0;
 
 	Saved_bPrevWantsToCrouch = 0;
+	Saved_Stamina = 0.f;
+	Saved_DashCooldownRemaining = 0.f;
+	Saved_SprintTime = 0.f;
+	Saved_SlideTime = 0.f;
+
+	GroundQueries.Reset();
 }
 
 uint8 UAdvancedMovementComponent::FSavedMove_Advanced::GetCompressedFlags() const
@@ -80,6 +143,15 @@ void UAdvancedMovementComponent::FSavedMove_Advanced::SetMoveFor(ACharacter* C,
 	Saved_bWantsToDash = MovementComponent->Safe_bWantsToDash;
 
 	Saved_bPrevWantsToCrouch = MovementComponent->Safe_bPrevWantsToCrouch;
+	Saved_Stamina = MovementComponent->Safe_Stamina;
+	Saved_DashCooldownRemaining = MovementComponent->Safe_DashCooldownRemaining;
+	Saved_SprintTime = MovementComponent->Safe_SprintTime;
+	Saved_SlideTime = MovementComponent->Safe_SlideTime;
+	ADVANCEDMOVEMENT_NET_STAT(MovementComponent->NetStats.RecordCreated());
+
+	// Record the ground traces of the movement about to be performed for this move
+	GroundQueries.Reset();
+	MovementComponent->GroundQueryRecording = &GroundQueries;
 }
 
 void UAdvancedMovementComponent::FSavedMove_Advanced::PrepMoveFor(ACharacter* C)
@@ -92,6 +164,24 @@ void UAdvancedMovementComponent::FSavedMove_Advanced::PrepMoveFor(ACharacter* C)
 	MovementComponent->Safe_bWantsToDash = Saved_bWantsToDash;
 
 	MovementComponent->Safe_bPrevWantsToCrouch = Saved_bPrevWantsToCrouch;
+
+	// A replayed move starts from a different location, its uncrouch is tested again
+	MovementComponent->bSlideUnCrouchBlocked = false;
+
+	if (MovementComponent->bClientUpdating)
+	{
+		GroundQueries.ReplayUsedMask = 0;
+		MovementComponent->GroundQueryReplay = &GroundQueries;
+	}
+}
+
+void UAdvancedMovementComponent::FSavedMove_Advanced::PostUpdate(ACharacter* C, EPostUpdateMode PostUpdateMode)
+{
+	FSavedMove_Character::PostUpdate(C, PostUpdateMode);
+
+	UAdvancedMovementComponent* MovementComponent = Cast<UAdvancedMovementComponent>(C->GetCharacterMovement());
+	MovementComponent->GroundQueryRecording = nullptr;
+	MovementComponent->GroundQueryReplay = nullptr;
 }
 
 UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::FNetworkPredictionData_Client_Advanced(
@@ -100,19 +190,149 @@ UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::FNetworkPred
 {
 }
 
+UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::~FNetworkPredictionData_Client_Advanced()
+{
+	// Release every slab handle while the slab is still alive, the base destructor runs after our members are gone
+	SavedMoves.Empty();
+	FreeMoves.Empty();
+	PendingMove = nullptr;
+	LastAckedMove = nullptr;
+	FreeSlabMoves.Empty();
+}
+
+void UAdvancedMovementComponent::FAdvancedMoveResponseDataContainer::ServerFillResponseData(
+	const UCharacterMovementComponent& CharacterMovement, const FClientAdjustment& PendingAdjustment)
+{
+	FCharacterMoveResponseDataContainer::ServerFillResponseData(CharacterMovement, PendingAdjustment);
+
+	const UAdvancedMovementComponent& movement = static_cast<const UAdvancedMovementComponent&>(CharacterMovement);
+	Stamina = movement.Safe_Stamina;
+	DashCooldownRemaining = movement.Safe_DashCooldownRemaining;
+	SprintTime = movement.Safe_SprintTime;
+	SlideTime = movement.Safe_SlideTime;
+#if ADVANCEDMOVEMENT_WITH_DEBUG_STATS
+	if (IsCorrection())
+	{
+		movement.GetFrameDebugStats().AddCorrection(movement.GetWorld()->GetTimeSeconds());
+	}
+#endif
+}
+
+bool UAdvancedMovementComponent::FAdvancedMoveResponseDataContainer::Serialize(
+	UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap)
+{
+	if (!FCharacterMoveResponseDataContainer::Serialize(CharacterMovement, Ar, PackageMap))
+	{
+		return false;
+	}
+
+	// Good moves stay as small as before, predicted state only travels with corrections
+	const UAdvancedMovementComponent& movement = static_cast<const UAdvancedMovementComponent&>(CharacterMovement);
+	if (IsCorrection() && movement.bUseStamina)
+	{
+		Ar << Stamina;
+	}
+	if (IsCorrection() && FAdvancedMovementFeatures::bWithDash)
+	{
+		Ar << DashCooldownRemaining;
+	}
+	if (IsCorrection() && movement.SprintRampTable.IsBaked())
+	{
+		Ar << SprintTime;
+	}
+	if (IsCorrection() && movement.SlideDecayTable.IsBaked())
+	{
+		Ar << SlideTime;
+	}
+
+	return !Ar.IsError();
+}
+
 FSavedMovePtr UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::AllocateNewMove()
 {
+	LLM_SCOPE_BYTAG(AdvancedMovement_SavedMoves);
+	if (FreeSlabMoves.Num() > 0)
+	{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+		return MakeSlabMove(FreeSlabMoves.Pop(false));
+#else
+		return MakeSlabMove(FreeSlabMoves.Pop(EAllowShrinking::No));
+#endif
+	}
 	return MakeShared<FSavedMove_Advanced>();
 }
 
+void UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::PrewarmSavedMoves(int32 NumMoves)
+{
+	if (NumMoves <= 0 || SavedMoveSlab.Num() > 0)
+	{
+		return;
+	}
+	LLM_SCOPE_BYTAG(AdvancedMovement_SavedMoves);
+
+	SavedMoveSlab.SetNum(NumMoves);
+	FreeSlabMoves.Reserve(NumMoves);
+	SavedMoves.Reserve(MaxSavedMoveCount);
+
+	// The base free list takes what it can hold, the rest is handed out by AllocateNewMove
+	const int32 numFree = FMath::Min(NumMoves, MaxFreeMoveCount);
+	FreeMoves.Reserve(MaxFreeMoveCount);
+	for (int32 i = 0; i < NumMoves; ++i)
+	{
+		if (i < numFree)
+		{
+			FreeMoves.Push(MakeSlabMove(&SavedMoveSlab[i]));
+		}
+		else
+		{
+			FreeSlabMoves.Push(&SavedMoveSlab[i]);
+		}
+	}
+}
+
+FSavedMovePtr UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::MakeSlabMove(
+	FSavedMove_Advanced* Move)
+{
+	return FSavedMovePtr(Move, [this](FSavedMove_Advanced* InMove)
+	{
+		InMove->Clear();
+		FreeSlabMoves.Push(InMove);
+	});
+}
+
+SIZE_T UAdvancedMovementComponent::FNetworkPredictionData_Client_Advanced::GetAllocatedSize() const
+{
+	SIZE_T result = sizeof(*this) + SavedMoves.GetAllocatedSize() + FreeMoves.GetAllocatedSize()
+		+ SavedMoveSlab.GetAllocatedSize() + FreeSlabMoves.GetAllocatedSize();
+
+	// Moves outside the slab were allocated one by one
+	const auto countHeapMoves = [this](const TArray<FSavedMovePtr>& InMoves)
+	{
+		SIZE_T bytes = 0;
+		for (const FSavedMovePtr& move : InMoves)
+		{
+			const FSavedMove_Advanced* advancedMove = static_cast<const FSavedMove_Advanced*>(move.Get());
+			if (advancedMove && (SavedMoveSlab.Num() == 0 || advancedMove < SavedMoveSlab.GetData()
+				|| advancedMove >= SavedMoveSlab.GetData() + SavedMoveSlab.Num()))
+			{
+				bytes += sizeof(FSavedMove_Advanced);
+			}
+		}
+		return bytes;
+	};
+	return result + countHeapMoves(SavedMoves) + countHeapMoves(FreeMoves);
+}
+
 // Sets default values for this component's properties
 UAdvancedMovementComponent::UAdvancedMovementComponent(): DashStartTime(0), AdvancedCharacter(nullptr),
-                                                          Proxy_bDashStart(false)
+                                                          Proxy_bDashStart(false), AsyncPhysics(nullptr),
+                                                          Significance(nullptr)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	NavAgentProps.bCanCrouch = true;
 	bCanWalkOffLedges = true;
 	bCanWalkOffLedgesWhenCrouching = true;
+	SetMoveResponseDataContainer(AdvancedMoveResponseData);
 }
 
 
@@ -121,14 +341,190 @@ void UAdvancedMovementComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// ...
+	if (const UAdvancedMovementEventSubsystem* eventSubsystem = GetWorld()->GetSubsystem<UAdvancedMovementEventSubsystem>())
+	{
+		EventStream = eventSubsystem->GetEventStream();
+	}
+
+	if (bUseAsyncPhysics)
+	{
+		AsyncPhysics = GetWorld()->GetSubsystem<UAdvancedMovementAsyncSubsystem>();
+	}
+
+	if (bRecordLagCompensationHistory && (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer)))
+	{
+		if (UAdvancedMovementHistorySubsystem* history = GetWorld()->GetSubsystem<UAdvancedMovementHistorySubsystem>())
+		{
+			history->RegisterCharacter(AdvancedCharacter);
+		}
+	}
+
+	if (bUseSignificanceGovernor && GetOwnerRole() == ROLE_Authority)
+	{
+		Significance = GetWorld()->GetSubsystem<UAdvancedMovementSignificanceSubsystem>();
+		if (Significance)
+		{
+			Significance->RegisterComponent(this);
+		}
+	}
+
+	if (bUseBatchedTick)
+	{
+		if (UAdvancedMovementTickSubsystem* tickSubsystem = GetWorld()->GetSubsystem<UAdvancedMovementTickSubsystem>())
+		{
+			tickSubsystem->RegisterComponent(this);
+
+			AActor* owner = GetOwner();
+			static const FName ReceiveTickName = TEXT("ReceiveTick");
+			if (bBatchedTickDisablesActorTick && !owner->GetClass()->IsFunctionImplementedInScript(ReceiveTickName))
+			{
+				owner->SetActorTickEnabled(false);
+			}
+			HandleControllerChanged();
+		}
+		else
+		{
+			// Editor preview worlds etc. keep the regular tick
+			bUseBatchedTick = false;
+		}
+	}
+}
+
+void UAdvancedMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bUseBatchedTick)
+	{
+		if (UAdvancedMovementTickSubsystem* tickSubsystem = GetWorld()->GetSubsystem<UAdvancedMovementTickSubsystem>())
+		{
+			tickSubsystem->RemoveControllerPrerequisite(BatchedTickController.Get());
+			tickSubsystem->UnregisterComponent(this);
+		}
+		BatchedTickController.Reset();
+	}
+	if (bRecordLagCompensationHistory)
+	{
+		if (UAdvancedMovementHistorySubsystem* history = GetWorld()->GetSubsystem<UAdvancedMovementHistorySubsystem>())
+		{
+			history->UnregisterCharacter(AdvancedCharacter);
+		}
+	}
+
+	if (Significance)
+	{
+		Significance->UnregisterComponent(this);
+		Significance = nullptr;
+		SetSignificanceTier(0);
+	}
+
+	EventStream.Reset();
+	if (AsyncPhysics)
+	{
+		// Stops the physics thread integrating a slide of a destroyed component
+		AsyncPhysics->EndSlide(GetUniqueID());
+		AsyncPhysics = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAdvancedMovementComponent::HandleControllerChanged()
+{
+	if (!bUseBatchedTick || !HasBegunPlay())
+	{
+		return;
+	}
+
+	UAdvancedMovementTickSubsystem* tickSubsystem = GetWorld()->GetSubsystem<UAdvancedMovementTickSubsystem>();
+	if (!tickSubsystem)
+	{
+		return;
+	}
+
+	AController* newController = PawnOwner ? PawnOwner->GetController() : nullptr;
+	if (BatchedTickController.Get() == newController)
+	{
+		return;
+	}
+
+	tickSubsystem->RemoveControllerPrerequisite(BatchedTickController.Get());
+	tickSubsystem->AddControllerPrerequisite(newController);
+	BatchedTickController = newController;
 }
 
 
 void UAdvancedMovementComponent::InitializeComponent()
 {
+	LLM_SCOPE_BYTAG(AdvancedMovement);
 	Super::InitializeComponent();
 	AdvancedCharacter = Cast<AAdvancedMovementCharacter>(GetOwner());
+	Safe_Stamina = Stamina_Max;
+	RefreshCustomModes();
+}
+
+void UAdvancedMovementComponent::RegisterCustomModes()
+{
+	if constexpr (FAdvancedMovementFeatures::bWithSlide)
+	{
+		FCustomModeDescriptor slide;
+		slide.Phys = &UAdvancedMovementComponent::PhysSlide;
+		slide.Enter = &UAdvancedMovementComponent::EnterSlide;
+		slide.Exit = &UAdvancedMovementComponent::ExitSlide;
+		slide.MaxSpeed = Slide_MaxSpeed;
+		slide.MaxBrakingDeceleration = Slide_MaxBrakingDeceleration;
+		RegisterCustomMode(CMOVE_Slide, slide);
+	}
+}
+
+void UAdvancedMovementComponent::RegisterCustomMode(uint8 InCustomMode, const FCustomModeDescriptor& InDescriptor)
+{
+	if (!CustomModes.IsValidIndex(InCustomMode))
+	{
+		CustomModes.SetNum(InCustomMode + 1);
+	}
+	CustomModes[InCustomMode] = InDescriptor;
+
+	if (MovementMode == MOVE_Custom && CustomMovementMode == InCustomMode)
+	{
+		CacheActiveCustomMode();
+	}
+}
+
+const UAdvancedMovementComponent::FCustomModeDescriptor* UAdvancedMovementComponent::FindCustomMode(
+	uint8 InCustomMode) const
+{
+	return CustomModes.IsValidIndex(InCustomMode) && CustomModes[InCustomMode].Phys
+		       ? &CustomModes[InCustomMode]
+		       : nullptr;
+}
+
+void UAdvancedMovementComponent::RefreshCustomModes()
+{
+	CustomModes.Reset();
+	RegisterCustomModes();
+	CacheActiveCustomMode();
+
+	// Resolved again from the next slide surface
+	SlideSurfaceComponent.Reset();
+	SlideSurfaceMaterial.Reset();
+	ActiveSlideFriction = Slide_Friction;
+	ActiveSlideGravityForce = Slide_GravityForce;
+
+	// Sampled once here, the move loop only reads the tables
+	SprintRampTable.Bake(Sprint_RampCurve, 1.f);
+	SlideDecayTable.Bake(Slide_DecayCurve, 1.f);
+}
+
+void UAdvancedMovementComponent::CacheActiveCustomMode()
+{
+	const FCustomModeDescriptor* activeMode = MovementMode == MOVE_Custom ? FindCustomMode(CustomMovementMode) : nullptr;
+	ActiveCustomModeIndex = activeMode ? CustomMovementMode : INDEX_NONE;
+	CachedCustomMaxSpeed = activeMode ? activeMode->MaxSpeed : 0.f;
+	CachedCustomMaxBrakingDeceleration = activeMode ? activeMode->MaxBrakingDeceleration : 0.f;
+
+	if (MovementMode == MOVE_Custom && !activeMode)
+	{
+		ADVANCEDMOVEMENT_LOG_ERROR("Unregistered custom movement mode %d", CustomMovementMode);
+	}
 }
 
 
@@ -138,7 +534,29 @@ void UAdvancedMovementComponent::TickComponent(float DeltaTime, ELevelTick TickT
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// ...
+	PublishSnapshot();
+}
+
+void UAdvancedMovementComponent::PublishSnapshot()
+{
+	FAdvancedMovementSnapshot snapshot;
+	snapshot.MovementMode = MovementMode;
+	snapshot.CustomMovementMode = CustomMovementMode;
+	snapshot.bIsSliding = IsSliding();
+	snapshot.bIsSprinting = IsSprinting();
+	snapshot.DashDirection = LastDashDirection;
+	snapshot.TimeSinceDash = GetWorld()->GetTimeSeconds() - DashStartTime;
+	snapshot.GroundSpeed = Velocity.Size2D();
+	snapshot.SlideSurfaceNormal = LastSlideSurfaceNormal;
+
+	FRWScopeLock lock(SnapshotLock, SLT_Write);
+	PublishedSnapshot = snapshot;
+}
+
+FAdvancedMovementSnapshot UAdvancedMovementComponent::GetMovementSnapshot() const
+{
+	FRWScopeLock lock(SnapshotLock, SLT_ReadOnly);
+	return PublishedSnapshot;
 }
 
 FNetworkPredictionData_Client* UAdvancedMovementComponent::GetPredictionData_Client() const
@@ -146,6 +564,7 @@ FNetworkPredictionData_Client* UAdvancedMovementComponent::GetPredictionData_Cli
 	check(PawnOwner != nullptr);
 	if (ClientPredictionData == nullptr)
 	{
+		LLM_SCOPE_BYTAG(AdvancedMovement_Prediction);
 		UAdvancedMovementComponent* MutableThis = const_cast<UAdvancedMovementComponent*>(this);
 		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Advanced(*this);
 		MutableThis->ClientPredictionData->MaxSmoothNetUpdateDist = 92.f;
@@ -155,57 +574,122 @@ FNetworkPredictionData_Client* UAdvancedMovementComponent::GetPredictionData_Cli
 	return ClientPredictionData;
 }
 
+void UAdvancedMovementComponent::PrewarmPredictionData()
+{
+	if (!PawnOwner || PawnOwner->GetLocalRole() != ROLE_AutonomousProxy)
+	{
+		return;
+	}
+
+	FNetworkPredictionData_Client_Advanced* clientData = static_cast<FNetworkPredictionData_Client_Advanced*>(
+		GetPredictionData_Client());
+	clientData->PrewarmSavedMoves(Net_PrewarmedSavedMoves);
+}
+
 void UAdvancedMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
 {
 	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
-	if (PreviousMovementMode == MOVE_Custom && PreviousCustomMode == CMOVE_Slide)
+	if (PreviousMovementMode == MOVE_Custom)
 	{
-		ExitSlide();
-		OnLeftSlide.Broadcast(this, PreviousMovementMode, PreviousCustomMode);
+		const FCustomModeDescriptor* prevMode = FindCustomMode(PreviousCustomMode);
+		if (prevMode && prevMode->Exit)
+		{
+			(this->*prevMode->Exit)();
+		}
+		if (PreviousCustomMode == CMOVE_Slide)
+		{
+			BroadcastLeftSlide(PreviousMovementMode, PreviousCustomMode);
+		}
 	}
-	// if (PreviousMovementMode == MOVE_Custom && PreviousCustomMode == CMOVE_Prone)
-	// {
-	// 	ExitProne();
-	// }
 
+	CacheActiveCustomMode();
+
+	const FCustomModeDescriptor* activeMode = GetActiveCustomMode();
+	if (activeMode && activeMode->Enter)
+	{
+		(this->*activeMode->Enter)(PreviousMovementMode, (ECustomMovementMode)PreviousCustomMode);
+	}
 	if (IsCustomMovementMode(CMOVE_Slide))
 	{
-		EnterSlide(PreviousMovementMode, (ECustomMovementMode)PreviousCustomMode);
-		OnEnteredSlide.Broadcast(this, PreviousMovementMode, PreviousCustomMode);
+		MarkInputEffect(EAdvancedMovementInput::Slide);
+		BroadcastEnteredSlide(PreviousMovementMode, PreviousCustomMode);
 	}
-	// if (IsCustomMovementMode(CMOVE_Prone))
-	// {
-	// 	EnterProne(PreviousMovementMode, (ECustomMovementMode)PreviousCustomMode);
-	// }
 	CharacterOwner->OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
 }
 
 void UAdvancedMovementComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME_CONDITION(UAdvancedMovementComponent, Proxy_bDashStart, COND_SkipOwner);
+	if constexpr (FAdvancedMovementFeatures::bWithDash)
+	{
+		DOREPLIFETIME_CONDITION(UAdvancedMovementComponent, Proxy_bDashStart, COND_SkipOwner);
+	}
+	else
+	{
+		DISABLE_REPLICATED_PROPERTY(UAdvancedMovementComponent, Proxy_bDashStart);
+	}
 }
 
 void UAdvancedMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
 {
 	Super::UpdateFromCompressedFlags(Flags);
 
-	bool bWantsSprint = (Flags & FSavedMove_Advanced::CompressedFlags::FLAG_Sprint) != 0;
-	if (bWantsSprint)
+	if constexpr (FAdvancedMovementFeatures::bWithSprint)
 	{
-		if (IsSprintingAllowed())
+		const bool bWasSprinting = Safe_bWantsToSprint;
+		bool bWantsSprint = (Flags & FSavedMove_Advanced::CompressedFlags::FLAG_Sprint) != 0;
+		if (bWantsSprint)
+		{
+			if (IsSprintingAllowed())
+			{
+				Safe_bWantsToSprint = true;
+			}
+		}
+		else
+		{
+			Safe_bWantsToSprint = false;
+		}
+		if (bWasSprinting != Safe_bWantsToSprint)
 		{
-			Safe_bWantsToSprint = true;
+			PushMovementEvent(Safe_bWantsToSprint
+				                  ? EAdvancedMovementEventType::SprintStart
+				                  : EAdvancedMovementEventType::SprintStop);
+			if (CharacterOwner->GetLocalRole() == ROLE_Authority && Safe_bWantsToSprint)
+			{
+				MarkInputPressed(EAdvancedMovementInput::Sprint);
+			}
+			else if (CharacterOwner->GetLocalRole() == ROLE_Authority)
+			{
+				MarkInputReleased(EAdvancedMovementInput::Sprint);
+			}
 		}
+		//UE_LOG(LogTemp, Warning, TEXT("UpdateFromCompressedFlags, Safe_bWantsToSprint: %d"), Safe_bWantsToSprint);
 	}
-	else
+
+	// Flags of disabled abilities are ignored, even if a client sends them
+	const bool bWasSliding = Safe_bWantsToSlide;
+	const bool bWasDashing = Safe_bWantsToDash;
+	Safe_bWantsToSlide = FAdvancedMovementFeatures::bWithSlide
+		&& (Flags & FSavedMove_Advanced::CompressedFlags::FLAG_Slide) != 0;
+	Safe_bWantsToDash = FAdvancedMovementFeatures::bWithDash
+		&& (Flags & FSavedMove_Advanced::CompressedFlags::FLAG_Dash) != 0;
+
+	// The server measures from the first move carrying the input
+	if (CharacterOwner->GetLocalRole() == ROLE_Authority)
 	{
-		Safe_bWantsToSprint = false;
+		if (!bWasSliding && Safe_bWantsToSlide)
+		{
+			MarkInputPressed(EAdvancedMovementInput::Slide);
+		}
+		else if (bWasSliding && !Safe_bWantsToSlide)
+		{
+			MarkInputReleased(EAdvancedMovementInput::Slide);
+		}
+		if (!bWasDashing && Safe_bWantsToDash)
+		{
+			MarkInputPressed(EAdvancedMovementInput::Dash);
+		}
 	}
-	//UE_LOG(LogTemp, Warning, TEXT("UpdateFromCompressedFlags, Safe_bWantsToSprint: %d"), Safe_bWantsToSprint);
-
-	Safe_bWantsToSlide = (Flags & FSavedMove_Advanced::CompressedFlags::FLAG_Slide) != 0;
-	Safe_bWantsToDash = (Flags & FSavedMove_Advanced::CompressedFlags::FLAG_Dash) != 0;
 }
 
 void UAdvancedMovementComponent::OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation,
@@ -214,11 +698,69 @@ void UAdvancedMovementComponent::OnMovementUpdated(float DeltaSeconds, const FVe
 	Super::OnMovementUpdated(DeltaSeconds, OldLocation, OldVelocity);
 
 	Safe_bPrevWantsToCrouch = bWantsToCrouch;
+	UpdateStamina(DeltaSeconds);
+	UpdateRampTimes(DeltaSeconds);
+
+	// The sprint speed cap applied to this move, only the first move after the press is recorded
+	if (FAdvancedMovementFeatures::bWithSprint
+		&& Safe_bWantsToSprint
+		&& IsMovementMode(MOVE_Walking)
+		&& !IsCrouching())
+	{
+		MarkInputEffect(EAdvancedMovementInput::Sprint);
+	}
+}
+
+void UAdvancedMovementComponent::UpdateRampTimes(float DeltaSeconds)
+{
+	Safe_SprintTime = Safe_bWantsToSprint && IsMovementMode(MOVE_Walking) ? Safe_SprintTime + DeltaSeconds : 0.f;
+	Safe_SlideTime = IsSliding() ? Safe_SlideTime + DeltaSeconds : 0.f;
+}
+
+float UAdvancedMovementComponent::GetSlideFriction() const
+{
+	return ActiveSlideFriction * SlideDecayTable.Evaluate(Safe_SlideTime);
+}
+
+void UAdvancedMovementComponent::UpdateStamina(float DeltaSeconds)
+{
+	if (!bUseStamina)
+	{
+		return;
+	}
+
+	float drainRate = 0.f;
+	if (IsSliding())
+	{
+		drainRate = Stamina_SlideDrainRate;
+	}
+	else if (Safe_bWantsToSprint && IsMovementMode(MOVE_Walking))
+	{
+		drainRate = Stamina_SprintDrainRate;
+	}
+
+	Safe_Stamina = drainRate > 0.f
+		               ? FMath::Max(Safe_Stamina - drainRate * DeltaSeconds, 0.f)
+		               : FMath::Min(Safe_Stamina + Stamina_RegenRate * DeltaSeconds, Stamina_Max);
+
+	// Both sides run out on the same move, so the next move carries no sprint flag
+	if (Safe_Stamina <= 0.f && Safe_bWantsToSprint)
+	{
+		Safe_bWantsToSprint = false;
+		PushMovementEvent(EAdvancedMovementEventType::SprintStop);
+	}
 }
 
 void UAdvancedMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
 {
+	// Counted in move time, so the server retests the uncrouch on the same move as the client
+	if (bSlideUnCrouchBlocked)
+	{
+		SlideUnCrouchBlockedTime += DeltaSeconds;
+	}
+
 	// Update before crouching update
+	if constexpr (FAdvancedMovementFeatures::bWithSlide)
 	{
 		if (MovementMode == MOVE_Walking && !bWantsToCrouch && Safe_bWantsToSlide)
 		{
@@ -247,20 +789,17 @@ void UAdvancedMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaS
 		// {
 		// 	SetMovementMode(MOVE_Walking);
 		// }
+	}
 
+	if constexpr (FAdvancedMovementFeatures::bWithDash)
+	{
+		// Counted in move time, so the server reaches zero on the same move as the client
+		Safe_DashCooldownRemaining = FMath::Max(0.f, Safe_DashCooldownRemaining - DeltaSeconds);
 
-		const bool bAuthProxy = CharacterOwner->HasAuthority() && !CharacterOwner->IsLocallyControlled();
-		const bool bEnoughTime = GetWorld()->GetTimeSeconds() - DashStartTime > Dash_AuthCooldownDuration;
-		const bool bCanDash = CanDash();
-		// UE_LOG(LogTemp, Log, TEXT("Safe_bWantsToDash: %d, bCanDash: %d\n!bAuthProxy: %d || %d: bEnoughTime"),
-		//        Safe_bWantsToDash, bCanDash, bAuthProxy, bEnoughTime);
-		if (Safe_bWantsToDash && !bCanDash)
-		{
-			Safe_bWantsToDash = false;
-		}
-		else if (Safe_bWantsToDash && bCanDash)
+		// A dash requested during the cooldown stays buffered until it ends, only CanDash rejects it
+		if (Safe_bWantsToDash && Safe_DashCooldownRemaining <= 0.f)
 		{
-			if (!bAuthProxy || bEnoughTime)
+			if (CanDash())
 			{
 				PerformDash();
 				Safe_bWantsToDash = false;
@@ -268,7 +807,10 @@ void UAdvancedMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaS
 			}
 			else
 			{
-				TRACEWARN(LogAdvancedMovement, "Client tried to cheat with dash");
+				Safe_bWantsToDash = false;
+				MarkInputReleased(EAdvancedMovementInput::Dash);
+				PushMovementEvent(EAdvancedMovementEventType::DashRejected);
+				ADVANCEDMOVEMENT_DEBUG_STAT(++GetFrameDebugStats().RejectedDashes);
 			}
 		}
 	}
@@ -276,16 +818,127 @@ void UAdvancedMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaS
 	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
 }
 
+void UAdvancedMovementComponent::ReplicateMoveToServer(float DeltaTime, const FVector& NewAcceleration)
+{
+	Super::ReplicateMoveToServer(DeltaTime, NewAcceleration);
+
+	// Never keep pointing into a saved move once the move was sent
+	GroundQueryRecording = nullptr;
+}
+
+void UAdvancedMovementComponent::ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse)
+{
+#if ADVANCEDMOVEMENT_WITH_DEBUG_STATS
+	if (MoveResponse.IsCorrection())
+	{
+		GetFrameDebugStats().AddCorrection(GetWorld()->GetTimeSeconds());
+	}
+#endif
+
+#if ADVANCEDMOVEMENT_WITH_NET_STATS
+	const int32 numPendingMoves = GetNumPendingSavedMoves();
+	Super::ClientHandleMoveResponse(MoveResponse);
+	NetStats.RecordAcked(FMath::Max(0, numPendingMoves - GetNumPendingSavedMoves()));
+#else
+	Super::ClientHandleMoveResponse(MoveResponse);
+#endif
+
+	// Replayed moves continue from the server values, like the corrected location. The replay runs on the next
+	// tick, and a correction of a move the client no longer has is ignored along with its state.
+	if (!WasCorrectionApplied(MoveResponse))
+	{
+		return;
+	}
+	bSlideUnCrouchBlocked = false;
+	const FAdvancedMoveResponseDataContainer& response = static_cast<const FAdvancedMoveResponseDataContainer&>(
+		MoveResponse);
+	if (bUseStamina)
+	{
+		Safe_Stamina = response.Stamina;
+	}
+	if constexpr (FAdvancedMovementFeatures::bWithDash)
+	{
+		Safe_DashCooldownRemaining = response.DashCooldownRemaining;
+	}
+	if (SprintRampTable.IsBaked())
+	{
+		Safe_SprintTime = response.SprintTime;
+	}
+	if (SlideDecayTable.IsBaked())
+	{
+		Safe_SlideTime = response.SlideTime;
+	}
+}
+
+bool UAdvancedMovementComponent::WasCorrectionApplied(const FCharacterMoveResponseDataContainer& MoveResponse) const
+{
+	if (!MoveResponse.IsCorrection() || !HasPredictionData_Client())
+	{
+		return false;
+	}
+
+	// ClientAdjustPosition acknowledges the corrected move and schedules the replay
+	const FNetworkPredictionData_Client_Character* clientData = GetPredictionData_Client_Character();
+	return clientData->bUpdatePosition
+		&& clientData->LastAckedMove.IsValid()
+		&& clientData->LastAckedMove->TimeStamp == MoveResponse.ClientAdjustment.TimeStamp;
+}
+
+void UAdvancedMovementComponent::CallServerMovePacked(const FSavedMove_Character* NewMove,
+                                                      const FSavedMove_Character* PendingMove,
+                                                      const FSavedMove_Character* OldMove)
+{
+	// The old move is a redundant resend of an unacknowledged important move
+	ADVANCEDMOVEMENT_NET_STAT(NetStats.RecordSent((NewMove ? 1 : 0) + (PendingMove ? 1 : 0)));
+	Super::CallServerMovePacked(NewMove, PendingMove, OldMove);
+}
+
+void UAdvancedMovementComponent::ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits)
+{
+	ADVANCEDMOVEMENT_NET_STAT(NetStats.RecordServerMovePacket(FMath::DivideAndRoundUp(PackedBits.DataBits.Num(), 8)));
+	Super::ServerMovePacked_ClientSend(PackedBits);
+}
+
+bool UAdvancedMovementComponent::VerifyClientTimeStamp(float TimeStamp, FNetworkPredictionData_Server_Character& ServerData)
+{
+#if ADVANCEDMOVEMENT_WITH_NET_STATS
+	// ServerMoveOld resends moves the server already processed, those are rejected but not dropped
+	const float currentTimeStamp = ServerData.CurrentClientTimeStamp;
+#endif
+	const bool bValid = Super::VerifyClientTimeStamp(TimeStamp, ServerData);
+#if ADVANCEDMOVEMENT_WITH_NET_STATS
+	if (!bValid && TimeStamp > currentTimeStamp)
+	{
+		NetStats.RecordDropped();
+	}
+#endif
+	return bValid;
+}
+
+bool UAdvancedMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+	const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+	GroundQueryReplay = nullptr;
+	return bResult;
+}
+
+void UAdvancedMovementComponent::PerformMovement(float DeltaTime)
+{
+#if ADVANCEDMOVEMENT_WITH_DEBUG_STATS
+	const uint64 startCycles = FPlatformTime::Cycles64();
+	Super::PerformMovement(DeltaTime);
+	GetFrameDebugStats().MovementCyclesThisFrame += FPlatformTime::Cycles64() - startCycles;
+#else
+	Super::PerformMovement(DeltaTime);
+#endif
+}
+
 void UAdvancedMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
 {
 	Super::PhysCustom(deltaTime, Iterations);
-	switch (CustomMovementMode)
+	if (const FCustomModeDescriptor* activeMode = GetActiveCustomMode())
 	{
-	case CMOVE_Slide:
-		PhysSlide(deltaTime, Iterations);
-		break;
-	default:
-		TRACEERROR(LogTemp, "Invalid movement mode");
+		(this->*activeMode->Phys)(deltaTime, Iterations);
 	}
 }
 
@@ -301,28 +954,55 @@ bool UAdvancedMovementComponent::CanCrouchInCurrentState() const
 	return Super::CanCrouchInCurrentState() && IsMovingOnGround();
 }
 
-float UAdvancedMovementComponent::GetMaxSpeed() const
+void UAdvancedMovementComponent::Crouch(bool bClientSimulation)
 {
-	if (IsMovementMode(MOVE_Walking)
-		&& Safe_bWantsToSprint
-		&& !IsCrouching())
+	bSlideUnCrouchPending = false;
+	Super::Crouch(bClientSimulation);
+}
+
+void UAdvancedMovementComponent::UnCrouch(bool bClientSimulation)
+{
+	if (bClientSimulation || !bSlideUnCrouchPending)
 	{
-		return Sprint_MaxSpeed;
+		Super::UnCrouch(bClientSimulation);
+		return;
 	}
 
+	// Retrying every move under the same low ceiling repeats the same encroachment test
+	const FVector location = UpdatedComponent->GetComponentLocation();
+	if (bSlideUnCrouchBlocked
+		&& SlideUnCrouchBlockedTime < Slide_UnCrouchRetestInterval
+		&& FVector::DistSquared(location, SlideUnCrouchBlockedLocation) <= FMath::Square(Slide_UnCrouchRetestDistance))
+	{
+		return;
+	}
 
-	if (MovementMode != MOVE_Custom)
-		return Super::GetMaxSpeed();
+	Super::UnCrouch(bClientSimulation);
+	ADVANCEDMOVEMENT_DEBUG_STAT(++GetFrameDebugStats().TracesThisFrame);
 
-	switch (CustomMovementMode)
+	bSlideUnCrouchBlocked = IsCrouching();
+	bSlideUnCrouchPending = bSlideUnCrouchBlocked;
+	SlideUnCrouchBlockedLocation = location;
+	SlideUnCrouchBlockedTime = 0.f;
+}
+
+float UAdvancedMovementComponent::GetMaxSpeed() const
+{
+	if (FAdvancedMovementFeatures::bWithSprint
+		&& IsMovementMode(MOVE_Walking)
+		&& Safe_bWantsToSprint
+		&& !IsCrouching())
 	{
-	case CMOVE_Slide:
-		return Slide_MaxSpeed;
-	default:
-		TRACEERROR(LogAdvancedMovement, "Invalid Movement Mode");
-		return 0.0f;
+		return SprintRampTable.IsBaked()
+			       ? FMath::Lerp(MaxWalkSpeed, Sprint_MaxSpeed, SprintRampTable.Evaluate(Safe_SprintTime))
+			       : Sprint_MaxSpeed;
 	}
-	//return 0.0f;
+
+
+	if (MovementMode != MOVE_Custom)
+		return Super::GetMaxSpeed();
+
+	return CachedCustomMaxSpeed;
 }
 
 float UAdvancedMovementComponent::GetMaxBrakingDeceleration() const
@@ -330,32 +1010,26 @@ float UAdvancedMovementComponent::GetMaxBrakingDeceleration() const
 	if (MovementMode != MOVE_Custom)
 		return Super::GetMaxBrakingDeceleration();
 
-	switch (CustomMovementMode)
-	{
-	case CMOVE_Slide:
-		return Slide_MaxBrakingDeceleration;
-	// case CMOVE_Prone:
-	// 	return Prone_MaxBrakingDeceleration;
-	default:
-		UE_LOG(LogTemp, Fatal, TEXT("Invalid Movement Mode"))
-		return -1.f;
-	}
+	return CachedCustomMaxBrakingDeceleration;
 }
 
 bool UAdvancedMovementComponent::IsSprintingAllowed() const
 {
-	return !IsCrouching() // Not crouching
+	return FAdvancedMovementFeatures::bWithSprint
+		&& !IsCrouching() // Not crouching
 		&& !IsFalling() // Not falling
 		&& !IsCustomMovementMode(CMOVE_Slide)
 		&& IsMovingOnGround() // Is moving on ground
 		&& Velocity.SizeSquared() >= 100.0f // Velocity must be not 0.0f
 		&& !Safe_bWantsToSprint
-		&& AdvancedCharacter->CanSprint(); // We should not sprint already
+		&& (!bUseStamina || Safe_Stamina > 0.f)
+		&& !AdvancedCharacter->IsAbilityBlocked(EAdvancedMovementAbility::Sprint); // We should not sprint already
 }
 
 void UAdvancedMovementComponent::EnterSlide(EMovementMode PrevMode, ECustomMovementMode PrevCustomMode)
 {
 	bWantsToCrouch = true;
+	++AsyncSlideSerial;
 	Velocity += Velocity.GetSafeNormal2D() * Slide_EnterImpulse;
 	FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, true, nullptr);
 }
@@ -363,6 +1037,12 @@ void UAdvancedMovementComponent::EnterSlide(EMovementMode PrevMode, ECustomMovem
 void UAdvancedMovementComponent::ExitSlide()
 {
 	bWantsToCrouch = false;
+	bSlideUnCrouchPending = true;
+	bSlideUnCrouchBlocked = false;
+	if (AsyncPhysics)
+	{
+		AsyncPhysics->EndSlide(GetUniqueID());
+	}
 	if (Slide_ResetVelocity)
 	{
 		Velocity = FVector::ZeroVector;
@@ -371,15 +1051,37 @@ void UAdvancedMovementComponent::ExitSlide()
 
 bool UAdvancedMovementComponent::CanSlide() const
 {
+	if constexpr (!FAdvancedMovementFeatures::bWithSlide)
+	{
+		return false;
+	}
+
 	const FVector start = UpdatedComponent->GetComponentLocation();
-	const FVector end = start +
-		CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() * 2.5f * FVector::DownVector;
-	static FName ProfileName = TEXT("BlockAll");
-	const bool bValidSurface = GetWorld()->LineTraceTestByProfile(start, end, ProfileName,
-	                                                              AdvancedCharacter->GetIgnoreCharacterParams());
+	bool bValidSurface;
+	if (!FindReplayedGroundQuery(FGroundQueryRecord::EQuery::CanSlide, start, nullptr, bValidSurface))
+	{
+		const FVector end = start +
+			CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() * 2.5f * FVector::DownVector;
+		static FName ProfileName = TEXT("BlockAll");
+		if (ConsumeGroundProbe(start, LastCanSlideSurfaceLocation))
+		{
+			bValidSurface = GetWorld()->LineTraceTestByProfile(start, end, ProfileName,
+			                                                   AdvancedCharacter->GetIgnoreCharacterParams());
+			ADVANCEDMOVEMENT_DEBUG_STAT(++GetFrameDebugStats().TracesThisFrame);
+			bLastCanSlideSurface = bValidSurface;
+			LastCanSlideSurfaceLocation = start;
+		}
+		else
+		{
+			bValidSurface = bLastCanSlideSurface;
+		}
+		RecordGroundQuery(FGroundQueryRecord::EQuery::CanSlide, start, nullptr, bValidSurface);
+	}
 	const bool bEnoughSpeed = Velocity.SizeSquared() > pow(Slide_MinSpeed, 2);
+	const bool bEnoughStamina = !bUseStamina || Safe_Stamina > 0.f;
 
-	return bValidSurface && bEnoughSpeed;
+	return bValidSurface && bEnoughSpeed && bEnoughStamina
+		&& !AdvancedCharacter->IsAbilityBlocked(EAdvancedMovementAbility::Slide);
 }
 
 
@@ -410,9 +1112,19 @@ void UAdvancedMovementComponent::PhysSlide(float DeltaTime, int32 Iterations)
 		StartNewPhysics(DeltaTime, Iterations);
 		return;
 	}
+	UpdateSlideSurfaceParams(surfaceHit);
+
+	// Integrated on the physics thread from the state submitted at the end of the last move
+	const bool bAsyncSlide = ShouldUseAsyncPhysics() && !bClientUpdating;
+	FVector asyncVelocity;
+	const bool bHasAsyncVelocity = bAsyncSlide
+		&& AsyncPhysics->ConsumeSlideVelocity(GetUniqueID(), AsyncSlideSerial, asyncVelocity);
 
 	// Surface gravity
-	Velocity += Slide_GravityForce * FVector::DownVector * DeltaTime;
+	if (!bHasAsyncVelocity)
+	{
+		Velocity += ActiveSlideGravityForce * FVector::DownVector * DeltaTime;
+	}
 
 	// Strafe
 	if (FMath::Abs(FVector::DotProduct(Acceleration.GetSafeNormal(), UpdatedComponent->GetRightVector())) > .5)
@@ -427,7 +1139,14 @@ void UAdvancedMovementComponent::PhysSlide(float DeltaTime, int32 Iterations)
 	// Calc Velocity
 	if (!HasAnimRootMotion() && !CurrentRootMotion.HasAdditiveVelocity())
 	{
-		CalcVelocity(DeltaTime, Slide_Friction, false, GetMaxBrakingDeceleration());
+		if (bHasAsyncVelocity)
+		{
+			Velocity = asyncVelocity;
+		}
+		else
+		{
+			CalcVelocity(DeltaTime, GetSlideFriction(), false, GetMaxBrakingDeceleration());
+		}
 	}
 
 	ApplyRootMotionToVelocity(DeltaTime);
@@ -437,12 +1156,12 @@ void UAdvancedMovementComponent::PhysSlide(float DeltaTime, int32 Iterations)
 	bJustTeleported = false;
 
 	FVector oldLoc = UpdatedComponent->GetComponentLocation();
-	FQuat oldRot = UpdatedComponent->GetComponentRotation().Quaternion();
 
 	FHitResult hit(1.f);
 	FVector adjusted = Velocity * DeltaTime; // x = v * at
+	LastSlideSurfaceNormal = surfaceHit.Normal;
 	FVector velPlaneDir = FVector::VectorPlaneProject(Velocity, surfaceHit.Normal).GetSafeNormal();
-	FQuat newRot = FRotationMatrix::MakeFromXZ(velPlaneDir, surfaceHit.Normal).ToQuat();
+	FQuat newRot = FilterRotationUpdate(FRotationMatrix::MakeFromXZ(velPlaneDir, surfaceHit.Normal).ToQuat());
 	SafeMoveUpdatedComponent(adjusted, newRot, true, hit);
 
 	// If we hit wall
@@ -452,17 +1171,32 @@ void UAdvancedMovementComponent::PhysSlide(float DeltaTime, int32 Iterations)
 		SlideAlongSurface(adjusted, (1.f - hit.Time), hit.Normal, hit, true);
 	}
 
+	// Throttled characters that barely moved leave exit detection to the pre-move probe of their next tick
 	FHitResult newSurfaceHit;
-	if (!GetSlideSurface(newSurfaceHit)
-		|| Velocity.SizeSquared() < FMath::Pow(Slide_MinSpeed, 2))
+	bool bSlideEnded = false;
+	if (Velocity.SizeSquared() < FMath::Pow(Slide_MinSpeed, 2)
+		|| (!CanReuseGroundProbe(UpdatedComponent->GetComponentLocation(), LastSlideSurfaceLocation)
+			&& !GetSlideSurface(newSurfaceHit)))
 	{
 		ExitSlide();
+		bSlideEnded = true;
 	}
 
 	if (!bJustTeleported && !HasAnimRootMotion() && !CurrentRootMotion.HasAdditiveVelocity())
 	{
 		Velocity = (UpdatedComponent->GetComponentLocation() - oldLoc) / DeltaTime; // v = dx/dt
 	}
+
+	// Submitted after the move, so the physics thread continues from the collision response
+	if (bAsyncSlide && !bSlideEnded)
+	{
+		const float slideFriction = GetSlideFriction();
+		const float brakingFriction = (bUseSeparateBrakingFriction ? BrakingFriction : slideFriction)
+			* FMath::Max(0.f, BrakingFrictionFactor);
+		AsyncPhysics->SubmitSlide(GetUniqueID(), AsyncSlideSerial, Velocity, Acceleration, ActiveSlideGravityForce,
+		                          slideFriction, brakingFriction, GetMaxBrakingDeceleration(), BrakingSubStepTime,
+		                          GetMaxSpeed());
+	}
 }
 
 
@@ -672,11 +1406,124 @@ void UAdvancedMovementComponent::PhysSlide(float DeltaTime, int32 Iterations)
 bool UAdvancedMovementComponent::GetSlideSurface(FHitResult& Hit) const
 {
 	FVector start = UpdatedComponent->GetComponentLocation();
+	bool bHit;
+	if (FindReplayedGroundQuery(FGroundQueryRecord::EQuery::SlideSurface, start, &Hit, bHit))
+	{
+		return bHit;
+	}
+
 	FVector end = start + CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() * 2.f *
 		FVector::DownVector;
 	static FName profileName = TEXT("BlockAll");
-	return GetWorld()->LineTraceSingleByProfile(Hit, start, end, profileName,
-	                                            AdvancedCharacter->GetIgnoreCharacterParams());
+	if (ConsumeGroundProbe(start, LastSlideSurfaceLocation))
+	{
+		FCollisionQueryParams params = AdvancedCharacter->GetIgnoreCharacterParams();
+		params.bReturnPhysicalMaterial = Slide_SurfaceTable != nullptr;
+		bHit = GetWorld()->LineTraceSingleByProfile(Hit, start, end, profileName, params);
+		ADVANCEDMOVEMENT_DEBUG_STAT(++GetFrameDebugStats().TracesThisFrame);
+		LastSlideSurfaceHit = Hit;
+		bLastSlideSurfaceHit = bHit;
+		LastSlideSurfaceLocation = start;
+	}
+	else
+	{
+		Hit = LastSlideSurfaceHit;
+		bHit = bLastSlideSurfaceHit;
+	}
+	RecordGroundQuery(FGroundQueryRecord::EQuery::SlideSurface, start, &Hit, bHit);
+	return bHit;
+}
+
+void UAdvancedMovementComponent::UpdateSlideSurfaceParams(const FHitResult& InSurfaceHit)
+{
+	if (!Slide_SurfaceTable)
+	{
+		ActiveSlideFriction = Slide_Friction;
+		ActiveSlideGravityForce = Slide_GravityForce;
+		return;
+	}
+
+	UPrimitiveComponent* surfaceComponent = InSurfaceHit.GetComponent();
+	UPhysicalMaterial* surfaceMaterial = InSurfaceHit.PhysMaterial.Get();
+	if (SlideSurfaceComponent.Get() == surfaceComponent && SlideSurfaceMaterial.Get() == surfaceMaterial)
+	{
+		return;
+	}
+
+	SlideSurfaceComponent = surfaceComponent;
+	SlideSurfaceMaterial = surfaceMaterial;
+	const FAdvancedSlideSurfaceParams& params = Slide_SurfaceTable->FindParams(surfaceMaterial);
+	ActiveSlideFriction = Slide_Friction * params.FrictionMultiplier;
+	ActiveSlideGravityForce = Slide_GravityForce * params.GravityForceMultiplier;
+}
+
+void UAdvancedMovementComponent::SetSignificanceTier(uint8 InTier)
+{
+	if (SignificanceTier == InTier)
+	{
+		return;
+	}
+	SignificanceTier = InTier;
+	SetComponentTickInterval(InTier == 0 ? 0.f : UAdvancedMovementSettings::Get()->GetTierTickInterval(InTier));
+}
+
+bool UAdvancedMovementComponent::CanReuseGroundProbe(const FVector& InLocation, const FVector& InProbeLocation) const
+{
+	return SignificanceTier != 0
+		&& FVector::DistSquared(InLocation, InProbeLocation)
+		<= FMath::Square(UAdvancedMovementSettings::Get()->GroundProbeReuseDistance);
+}
+
+bool UAdvancedMovementComponent::ConsumeGroundProbe(const FVector& InLocation, const FVector& InProbeLocation) const
+{
+	return !CanReuseGroundProbe(InLocation, InProbeLocation) || !Significance || Significance->TryConsumeGroundProbe();
+}
+
+bool UAdvancedMovementComponent::FindReplayedGroundQuery(FGroundQueryRecord::EQuery InType, const FVector& InStart,
+                                                         FHitResult* OutHit, bool& bOutHit) const
+{
+	if (!GroundQueryReplay)
+	{
+		return false;
+	}
+
+	const float toleranceSq = FMath::Square(Net_ReplayQueryTolerance);
+	for (int32 i = 0; i < GroundQueryReplay->Entries.Num(); ++i)
+	{
+		const uint8 bit = 1 << i;
+		const FGroundQueryRecord::FEntry& entry = GroundQueryReplay->Entries[i];
+		if ((GroundQueryReplay->ReplayUsedMask & bit) == 0
+			&& entry.Type == InType
+			&& FVector::DistSquared(entry.Start, InStart) <= toleranceSq)
+		{
+			GroundQueryReplay->ReplayUsedMask |= bit;
+			bOutHit = entry.bHit;
+			if (OutHit)
+			{
+				*OutHit = entry.Hit;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+void UAdvancedMovementComponent::RecordGroundQuery(FGroundQueryRecord::EQuery InType, const FVector& InStart,
+                                                   const FHitResult* InHit, bool bInHit) const
+{
+	if (!GroundQueryRecording || GroundQueryRecording->Entries.Num() >= FGroundQueryRecord::MaxQueries)
+	{
+		return;
+	}
+
+	FGroundQueryRecord::FEntry& entry = GroundQueryRecording->Entries.AddDefaulted_GetRef();
+	entry.Start = InStart;
+	entry.Type = InType;
+	entry.bHit = bInHit;
+	if (InHit)
+	{
+		entry.Hit = *InHit;
+	}
 }
 
 
@@ -690,12 +1537,19 @@ void UAdvancedMovementComponent::SprintPressed()
 	if (IsSprintingAllowed())
 	{
 		Safe_bWantsToSprint = true;
+		PushMovementEvent(EAdvancedMovementEventType::SprintStart);
+		MarkInputPressed(EAdvancedMovementInput::Sprint);
 	}
 }
 
 void UAdvancedMovementComponent::SprintReleased()
 {
+	if (Safe_bWantsToSprint)
+	{
+		PushMovementEvent(EAdvancedMovementEventType::SprintStop);
+	}
 	Safe_bWantsToSprint = false;
+	MarkInputReleased(EAdvancedMovementInput::Sprint);
 }
 
 void UAdvancedMovementComponent::CrouchPressed()
@@ -714,39 +1568,46 @@ void UAdvancedMovementComponent::CrouchReleased()
 
 void UAdvancedMovementComponent::SlidePressed()
 {
-	Safe_bWantsToSlide = true;
+	Safe_bWantsToSlide = FAdvancedMovementFeatures::bWithSlide;
+	MarkInputPressed(EAdvancedMovementInput::Slide);
 }
 
 void UAdvancedMovementComponent::SlideReleased()
 {
 	Safe_bWantsToSlide = false;
+	MarkInputReleased(EAdvancedMovementInput::Slide);
 }
 
 void UAdvancedMovementComponent::DashPressed()
 {
-	const float currentTime = GetWorld()->GetTimeSeconds();
-	if (IsAbleToDash())
-	{
-		Safe_bWantsToDash = true;
-	}
-	else
+	if constexpr (!FAdvancedMovementFeatures::bWithDash)
 	{
-		GetWorld()->GetTimerManager().
-		            SetTimer(TimerHandle_DashCooldown, this,
-		                     &UAdvancedMovementComponent::OnDashCooldownFinished,
-		                     Dash_CooldownDuration - (currentTime - DashStartTime));
+		return;
 	}
+
+	// Buffered by the move stream while the cooldown runs
+	MarkInputPressed(EAdvancedMovementInput::Dash);
+	Safe_bWantsToDash = true;
 }
 
 bool UAdvancedMovementComponent::IsAbleToDash() const
 {
-	const float currentTime = GetWorld()->GetTimeSeconds();
-	return currentTime - DashStartTime >= Dash_CooldownDuration;
+	if constexpr (!FAdvancedMovementFeatures::bWithDash)
+	{
+		return false;
+	}
+
+	return Safe_DashCooldownRemaining <= 0.f;
 }
 
 void UAdvancedMovementComponent::DashReleased()
 {
-	GetWorld()->GetTimerManager().ClearTimer(TimerHandle_DashCooldown);
+	// Releasing during the cooldown drops the buffered dash, a tap outside of it still fires on the next move
+	if (Safe_DashCooldownRemaining > 0.f)
+	{
+		Safe_bWantsToDash = false;
+		MarkInputReleased(EAdvancedMovementInput::Dash);
+	}
 }
 
 bool UAdvancedMovementComponent::IsCustomMovementMode(ECustomMovementMode InCustomMovementMode) const
@@ -761,53 +1622,89 @@ bool UAdvancedMovementComponent::IsMovementMode(EMovementMode InMovementMode) co
 
 bool UAdvancedMovementComponent::CanDash() const
 {
-	return IsWalking() &&
+	return FAdvancedMovementFeatures::bWithDash &&
+		IsWalking() &&
 		!IsSprinting() &&
 		!IsSliding() &&
 		!IsCrouching() &&
-		!IsFalling() && AdvancedCharacter->CanDash();
+		!IsFalling() &&
+		(!bUseStamina || Safe_Stamina >= Stamina_DashCost) &&
+		!AdvancedCharacter->IsAbilityBlocked(EAdvancedMovementAbility::Dash);
 }
 
 void UAdvancedMovementComponent::PerformDash()
 {
-	DashStartTime = GetWorld()->TimeSeconds;
+	MarkInputEffect(EAdvancedMovementInput::Dash);
+	// A replayed dash started when it was first simulated
+	if (!bClientUpdating)
+	{
+		DashStartTime = GetWorld()->TimeSeconds;
+	}
+	Safe_DashCooldownRemaining = Dash_CooldownDuration;
+	if (bUseStamina)
+	{
+		Safe_Stamina = FMath::Max(Safe_Stamina - Stamina_DashCost, 0.f);
+	}
 	FVector dashDir = (Acceleration.IsNearlyZero() ? UpdatedComponent->GetForwardVector() : Acceleration).
 		GetSafeNormal2D();
 	dashDir += FVector::UpVector * .1f;
 	const EDashDirection dashSide = CalculateDashDirection(CalculateDirection());
-	float dash_impulse;
-	switch (dashSide)
+	LastDashDirection = dashSide;
+	const float dash_impulse = GetDashImpulse(dashSide);
+
+	if (Dash_bUseRootMotionSource)
 	{
-	case DASH_Left:
-		dash_impulse = Dash_Impulse_L;
-		break;
-	case DASH_Right:
-		dash_impulse = Dash_Impulse_R;
-		break;
-	case DASH_Forward:
-		dash_impulse = Dash_Impulse_F;
-		break;
-	case DASH_Backward:
-		dash_impulse = Dash_Impulse_B;
-		break;
-	default:
-		dash_impulse = Dash_Impulse_F;
+		// Stays grounded and keeps the current facing, the root motion source drives the whole dash
+		ApplyDashRootMotion(dashDir.GetSafeNormal2D(), dashSide, dash_impulse);
+		BroadcastDashStarted(dashSide);
+		return;
 	}
 
 	Velocity = dash_impulse * dashDir;
 
-	const FQuat newRot = FRotationMatrix::MakeFromXZ(dashDir, FVector::UpVector).ToQuat();
-	FHitResult hit;
-	SafeMoveUpdatedComponent(FVector::ZeroVector, newRot, false, hit);
+	// Zero-delta moves with an unchanged rotation are skipped entirely
+	const FQuat newRot = FilterRotationUpdate(FRotationMatrix::MakeFromXZ(dashDir, FVector::UpVector).ToQuat());
+	if (!newRot.Equals(UpdatedComponent->GetComponentQuat(), SCENECOMPONENT_QUAT_TOLERANCE))
+	{
+		FHitResult hit;
+		SafeMoveUpdatedComponent(FVector::ZeroVector, newRot, false, hit);
+	}
 
 	SetMovementMode(MOVE_Falling);
 
-	OnDashStarted.Broadcast(this, dashSide);
+	BroadcastDashStarted(dashSide);
 }
 
-void UAdvancedMovementComponent::OnDashCooldownFinished()
+void UAdvancedMovementComponent::ApplyDashRootMotion(const FVector& InDirection, EDashDirection InDashSide,
+                                                     float InSpeed)
 {
-	Safe_bWantsToDash = true;
+	const FAdvancedDashRootMotionParams& params = GetDashRootMotionParams(InDashSide);
+
+	static const FName DashInstanceName = TEXT("AdvancedDash");
+	if (DashRootMotionSourceID != 0)
+	{
+		RemoveRootMotionSourceByID(DashRootMotionSourceID);
+	}
+
+	TSharedPtr<FRootMotionSource_AdvancedDash> dash = MakeShared<FRootMotionSource_AdvancedDash>();
+	dash->InstanceName = DashInstanceName;
+	dash->Priority = 500;
+	dash->Force = InDirection * InSpeed;
+	dash->Duration = params.Duration;
+	dash->StrengthOverTime = params.StrengthOverTime;
+	dash->DashDirection = InDashSide;
+	dash->FinishVelocityParams.Mode = ERootMotionFinishVelocityMode::ClampVelocity;
+	dash->FinishVelocityParams.ClampVelocity = Dash_RootMotionExitSpeed;
+	DashRootMotionSourceID = ApplyRootMotionSource(dash);
+}
+
+bool UAdvancedMovementComponent::ShouldUseAsyncPhysics() const
+{
+	// A predicting client would simulate different results, keep those characters on the game thread path
+	return AsyncPhysics != nullptr
+		&& CharacterOwner
+		&& CharacterOwner->HasAuthority()
+		&& CharacterOwner->GetRemoteRole() != ROLE_AutonomousProxy;
 }
 
 // ReSharper disable once CppMemberFunctionMayBeStatic
@@ -832,6 +1729,37 @@ UAdvancedMovementComponent::EDashDirection UAdvancedMovementComponent::Calculate
 	return EDashDirection::DASH_Forward;
 }
 
+float UAdvancedMovementComponent::GetDashImpulse(EDashDirection InDashSide) const
+{
+	switch (InDashSide)
+	{
+	case DASH_Left:
+		return Dash_Impulse_L;
+	case DASH_Right:
+		return Dash_Impulse_R;
+	case DASH_Backward:
+		return Dash_Impulse_B;
+	default:
+		return Dash_Impulse_F;
+	}
+}
+
+const FAdvancedDashRootMotionParams& UAdvancedMovementComponent::GetDashRootMotionParams(
+	EDashDirection InDashSide) const
+{
+	switch (InDashSide)
+	{
+	case DASH_Left:
+		return Dash_RootMotion_L;
+	case DASH_Right:
+		return Dash_RootMotion_R;
+	case DASH_Backward:
+		return Dash_RootMotion_B;
+	default:
+		return Dash_RootMotion_F;
+	}
+}
+
 float UAdvancedMovementComponent::CalculateDirection() const
 {
 	if (!IsValid(AdvancedCharacter))
@@ -856,7 +1784,295 @@ float UAdvancedMovementComponent::CalculateDirection() const
 	return forwardDeltaDegree;
 }
 
+FAdvancedMovementTrajectory UAdvancedMovementComponent::PredictSlideTrajectory(float MaxTime, float TimeStep,
+                                                                             bool bSweepEndpoint) const
+{
+	FAdvancedMovementTrajectory result;
+	if (!UpdatedComponent)
+	{
+		return result;
+	}
+
+	TimeStep = FMath::Max(TimeStep, MIN_TICK_TIME);
+	const FVector surfaceNormal = IsSliding()
+		                              ? LastSlideSurfaceNormal
+		                              : (CurrentFloor.IsWalkableFloor()
+			                                 ? CurrentFloor.HitResult.ImpactNormal
+			                                 : FVector::UpVector);
+
+	// Same order as PhysSlide: surface gravity, then braking with no input, then move along the surface
+	const FVector surfaceGravity = FVector::VectorPlaneProject(ActiveSlideGravityForce * FVector::DownVector,
+	                                                           surfaceNormal);
+	const float friction = FMath::Max(0.f, (bUseSeparateBrakingFriction ? BrakingFriction : ActiveSlideFriction)
+	                                  * FMath::Max(0.f, BrakingFrictionFactor));
+	const float brakingDeceleration = FMath::Max(0.f, Slide_MaxBrakingDeceleration);
+	const float minSpeedSq = FMath::Square(Slide_MinSpeed);
+	const float slideStartTime = IsSliding() ? Safe_SlideTime : 0.f;
+
+	FVector velocity = Velocity;
+	if (!IsSliding())
+	{
+		velocity += velocity.GetSafeNormal2D() * Slide_EnterImpulse;
+	}
+	velocity = FVector::VectorPlaneProject(velocity, surfaceNormal);
+
+	FVector location = UpdatedComponent->GetComponentLocation();
+	result.Points.Reserve(FMath::CeilToInt(MaxTime / TimeStep) + 1);
+	result.Points.Add(location);
+
+	while (result.Duration < MaxTime && velocity.SizeSquared() >= minSpeedSq)
+	{
+		velocity += surfaceGravity * TimeStep;
+
+		const FVector oldVelocity = velocity;
+		const FVector revAccel = -brakingDeceleration * velocity.GetSafeNormal();
+		const float stepFriction = bUseSeparateBrakingFriction
+			                           ? friction
+			                           : friction * SlideDecayTable.Evaluate(slideStartTime + result.Duration);
+		velocity += (-stepFriction * velocity + revAccel) * TimeStep;
+		if ((velocity | oldVelocity) <= 0.f)
+		{
+			velocity = FVector::ZeroVector;
+		}
+
+		location += velocity * TimeStep;
+		result.Duration += TimeStep;
+		result.Points.Add(location);
+	}
+
+	result.EndLocation = location;
+	if (bSweepEndpoint)
+	{
+		SweepTrajectoryEndpoint(result);
+	}
+	return result;
+}
+
+FAdvancedMovementTrajectory UAdvancedMovementComponent::PredictDashTrajectory(FVector InDirection, int32 NumPoints,
+                                                                            bool bSweepEndpoint) const
+{
+	FAdvancedMovementTrajectory result;
+	if (!UpdatedComponent)
+	{
+		return result;
+	}
+
+	NumPoints = FMath::Max(NumPoints, 2);
+	const FVector start = UpdatedComponent->GetComponentLocation();
+	FVector dashDir = (InDirection.IsNearlyZero() ? UpdatedComponent->GetForwardVector() : InDirection).
+		GetSafeNormal2D();
+	const EDashDirection dashSide = CalculateDashDirection(CalculateDirection());
+	const float dashImpulse = GetDashImpulse(dashSide);
+	result.Points.Reserve(NumPoints);
+	result.Points.Add(start);
+
+	if (Dash_bUseRootMotionSource)
+	{
+		const FAdvancedDashRootMotionParams& params = GetDashRootMotionParams(dashSide);
+		const float timeStep = params.Duration / (NumPoints - 1);
+		float prevStrength = params.StrengthOverTime ? params.StrengthOverTime->GetFloatValue(0.f) : 1.f;
+		float distance = 0.f;
+		for (int32 i = 1; i < NumPoints; ++i)
+		{
+			const float alpha = static_cast<float>(i) / (NumPoints - 1);
+			const float strength = params.StrengthOverTime ? params.StrengthOverTime->GetFloatValue(alpha) : 1.f;
+			distance += dashImpulse * .5f * (prevStrength + strength) * timeStep;
+			prevStrength = strength;
+			result.Points.Add(start + dashDir * distance);
+		}
+		result.Duration = params.Duration;
+	}
+	else
+	{
+		// Ballistic arc of the impulse until the start height is reached again
+		dashDir += FVector::UpVector * .1f;
+		const FVector velocity = dashImpulse * dashDir;
+		const float gravityZ = GetGravityZ();
+		result.Duration = gravityZ < 0.f ? -2.f * velocity.Z / gravityZ : 0.f;
+		for (int32 i = 1; i < NumPoints; ++i)
+		{
+			const float time = result.Duration * i / (NumPoints - 1);
+			result.Points.Add(start + velocity * time + FVector(0.f, 0.f, .5f * gravityZ * time * time));
+		}
+	}
+
+	result.EndLocation = result.Points.Last();
+	if (bSweepEndpoint)
+	{
+		SweepTrajectoryEndpoint(result);
+	}
+	return result;
+}
+
+void UAdvancedMovementComponent::SweepTrajectoryEndpoint(FAdvancedMovementTrajectory& InOutTrajectory) const
+{
+	if (!AdvancedCharacter || InOutTrajectory.Points.Num() == 0)
+	{
+		return;
+	}
+
+	FHitResult hit;
+	const FVector start = InOutTrajectory.Points[0];
+	const FCollisionShape shape = AdvancedCharacter->GetCapsuleComponent()->GetCollisionShape();
+	InOutTrajectory.bBlocked = GetWorld()->SweepSingleByChannel(hit, start, InOutTrajectory.EndLocation,
+	                                                            UpdatedComponent->GetComponentQuat(),
+	                                                            UpdatedComponent->GetCollisionObjectType(), shape,
+	                                                            AdvancedCharacter->GetIgnoreCharacterParams());
+	if (InOutTrajectory.bBlocked)
+	{
+		InOutTrajectory.EndLocation = hit.Location;
+	}
+}
+
+FQuat UAdvancedMovementComponent::FilterRotationUpdate(const FQuat& InNewRotation) const
+{
+	const FQuat currentRotation = UpdatedComponent->GetComponentQuat();
+	return currentRotation.AngularDistance(InNewRotation) < FMath::DegreesToRadians(MinRotationUpdateAngle)
+		       ? currentRotation
+		       : InNewRotation;
+}
+
 void UAdvancedMovementComponent::OnRep_DashStart()
 {
-	OnDashStarted.Broadcast(this, CalculateDashDirection(CalculateDirection()));
+	DashStartTime = GetWorld()->GetTimeSeconds();
+	LastDashDirection = CalculateDashDirection(CalculateDirection());
+	BroadcastDashStarted(LastDashDirection);
+}
+
+void UAdvancedMovementComponent::BroadcastEnteredSlide(EMovementMode PrevMode, uint8 PrevCustomMode)
+{
+	PushMovementEvent(EAdvancedMovementEventType::SlideEnter);
+	OnEnteredSlideNative.Broadcast(this, PrevMode, PrevCustomMode);
+	if (OnEnteredSlide.IsBound())
+	{
+		OnEnteredSlide.Broadcast(this, PrevMode, PrevCustomMode);
+	}
+}
+
+void UAdvancedMovementComponent::BroadcastLeftSlide(EMovementMode PrevMode, uint8 PrevCustomMode)
+{
+	PushMovementEvent(EAdvancedMovementEventType::SlideExit);
+	OnLeftSlideNative.Broadcast(this, PrevMode, PrevCustomMode);
+	if (OnLeftSlide.IsBound())
+	{
+		OnLeftSlide.Broadcast(this, PrevMode, PrevCustomMode);
+	}
+}
+
+void UAdvancedMovementComponent::BroadcastDashStarted(uint8 DashDirection)
+{
+	PushMovementEvent(EAdvancedMovementEventType::DashStart, DashDirection);
+	OnDashStartedNative.Broadcast(this, DashDirection);
+	if (OnDashStarted.IsBound())
+	{
+		OnDashStarted.Broadcast(this, DashDirection);
+	}
+}
+
+FAdvancedMovementDebugStats& UAdvancedMovementComponent::GetFrameDebugStats() const
+{
+	DebugStats.BeginFrame(GFrameCounter);
+	return DebugStats;
+}
+
+double UAdvancedMovementComponent::GetLatencyClock(bool& bOutServer) const
+{
+	bOutServer = CharacterOwner
+		&& CharacterOwner->GetLocalRole() == ROLE_Authority
+		&& CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy;
+	if (bOutServer)
+	{
+		const FNetworkPredictionData_Server_Character* serverData = HasPredictionData_Server()
+			                                                            ? GetPredictionData_Server_Character()
+			                                                            : nullptr;
+		return serverData ? serverData->CurrentClientTimeStamp : 0.0;
+	}
+	return FPlatformTime::Seconds();
+}
+
+void UAdvancedMovementComponent::MarkInputPressed(EAdvancedMovementInput InInput) const
+{
+#if ADVANCEDMOVEMENT_WITH_LATENCY_STATS
+	double& pressTime = LatencyPressTimes[static_cast<uint8>(InInput)];
+	if (pressTime < 0.0 && !bClientUpdating)
+	{
+		bool bServer;
+		pressTime = GetLatencyClock(bServer);
+	}
+#endif
+}
+
+void UAdvancedMovementComponent::MarkInputReleased(EAdvancedMovementInput InInput) const
+{
+#if ADVANCEDMOVEMENT_WITH_LATENCY_STATS
+	if (!bClientUpdating)
+	{
+		LatencyPressTimes[static_cast<uint8>(InInput)] = -1.0;
+	}
+#endif
+}
+
+void UAdvancedMovementComponent::MarkInputEffect(EAdvancedMovementInput InInput) const
+{
+#if ADVANCEDMOVEMENT_WITH_LATENCY_STATS
+	double& pressTime = LatencyPressTimes[static_cast<uint8>(InInput)];
+	if (pressTime < 0.0 || bClientUpdating)
+	{
+		return;
+	}
+
+	bool bServer;
+	const double latency = GetLatencyClock(bServer) - pressTime;
+	pressTime = -1.0;
+
+	// Client timestamps are reset periodically, a negative latency spans a reset
+	if (latency >= 0.0)
+	{
+		FAdvancedMovementLatencyStats::Get().AddSample(InInput, bServer, static_cast<float>(latency * 1000.0));
+	}
+#endif
+}
+
+float UAdvancedMovementComponent::GetDashCooldownRemaining() const
+{
+	return Safe_DashCooldownRemaining;
+}
+
+int32 UAdvancedMovementComponent::GetNumPendingSavedMoves() const
+{
+	const FNetworkPredictionData_Client_Character* clientData = HasPredictionData_Client()
+		                                                            ? GetPredictionData_Client_Character()
+		                                                            : nullptr;
+	return clientData ? clientData->SavedMoves.Num() : 0;
+}
+
+SIZE_T UAdvancedMovementComponent::GetPredictionDataAllocatedSize() const
+{
+	SIZE_T result = 0;
+	if (HasPredictionData_Client())
+	{
+		result += static_cast<const FNetworkPredictionData_Client_Advanced*>(ClientPredictionData)->GetAllocatedSize();
+	}
+	if (HasPredictionData_Server())
+	{
+		result += sizeof(FNetworkPredictionData_Server_Character);
+	}
+	return result;
+}
+
+void UAdvancedMovementComponent::PushMovementEvent(EAdvancedMovementEventType InType, uint8 InPayload) const
+{
+	// Replayed moves already published their events when they were first simulated
+	if (!EventStream.IsValid() || bClientUpdating)
+	{
+		return;
+	}
+
+	FAdvancedMovementEvent event;
+	event.WorldTime = GetWorld()->GetTimeSeconds();
+	event.Location = UpdatedComponent ? FVector3f(UpdatedComponent->GetComponentLocation()) : FVector3f::ZeroVector;
+	event.ComponentId = GetUniqueID();
+	event.Type = InType;
+	event.Payload = InPayload;
+	EventStream->Push(event);
 }
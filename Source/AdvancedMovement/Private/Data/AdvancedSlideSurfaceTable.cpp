@@ -0,0 +1,12 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Data/AdvancedSlideSurfaceTable.h"
+
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+const FAdvancedSlideSurfaceParams& UAdvancedSlideSurfaceTable::FindParams(const UPhysicalMaterial* InMaterial) const
+{
+	const FAdvancedSlideSurfaceParams* params = InMaterial ? Surfaces.Find(InMaterial) : nullptr;
+	return params ? *params : DefaultParams;
+}
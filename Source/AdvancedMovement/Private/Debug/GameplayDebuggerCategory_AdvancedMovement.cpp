@@ -0,0 +1,114 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Debug/GameplayDebuggerCategory_AdvancedMovement.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "Actors/AdvancedMovementCharacter.h"
+#include "Components/AdvancedMovementComponent.h"
+
+FGameplayDebuggerCategory_AdvancedMovement::FGameplayDebuggerCategory_AdvancedMovement()
+{
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_AdvancedMovement::MakeInstance()
+{
+	return MakeShareable(new FGameplayDebuggerCategory_AdvancedMovement());
+}
+
+void FGameplayDebuggerCategory_AdvancedMovement::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << ModeName;
+	Ar << MovementMs;
+	Ar << Traces;
+	Ar << RecentCorrections;
+	Ar << TotalCorrections;
+	Ar << DashCooldownRemaining;
+	Ar << RejectedDashes;
+	Ar << DroppedMoves;
+	Ar << SignificanceTier;
+	Ar << bHasStats;
+}
+
+void FGameplayDebuggerCategory_AdvancedMovement::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	const AAdvancedMovementCharacter* character = Cast<AAdvancedMovementCharacter>(DebugActor);
+	const UAdvancedMovementComponent* movement = character
+		                                             ? Cast<UAdvancedMovementComponent>(
+			                                             character->GetCharacterMovement())
+		                                             : nullptr;
+	if (!movement)
+	{
+		DataPack = FRepData();
+		return;
+	}
+
+	const FAdvancedMovementDebugStats& stats = movement->GetDebugStats();
+	const double now = movement->GetWorld()->GetTimeSeconds();
+	DataPack.ModeName = movement->IsSliding() ? TEXT("Slide") : movement->GetMovementName();
+	DataPack.MovementMs = stats.MovementMsLastFrame;
+	DataPack.Traces = stats.TracesLastFrame;
+	DataPack.RecentCorrections = stats.CountCorrectionsSince(now - CorrectionWindow);
+	DataPack.TotalCorrections = stats.NumCorrections;
+	DataPack.DashCooldownRemaining = movement->GetDashCooldownRemaining();
+	DataPack.RejectedDashes = stats.RejectedDashes;
+	DataPack.DroppedMoves = movement->GetNetStats().MovesDropped;
+	DataPack.SignificanceTier = movement->GetSignificanceTier();
+	DataPack.bHasStats = ADVANCEDMOVEMENT_WITH_DEBUG_STATS != 0;
+}
+
+void FGameplayDebuggerCategory_AdvancedMovement::DrawData(APlayerController* OwnerPC,
+                                                          FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	CanvasContext.Printf(TEXT("{yellow}Mode: {white}%s  {yellow}Significance tier: {white}%u"), *DataPack.ModeName,
+	                     DataPack.SignificanceTier);
+	if (DataPack.bHasStats)
+	{
+		CanvasContext.Printf(TEXT("{yellow}Movement cost: {white}%.3f ms  {yellow}Traces: {white}%d"),
+		                     DataPack.MovementMs, DataPack.Traces);
+		CanvasContext.Printf(TEXT("{yellow}Corrections: {white}%d in %.0fs, %d total"), DataPack.RecentCorrections,
+		                     CorrectionWindow, DataPack.TotalCorrections);
+		CanvasContext.Printf(TEXT("{yellow}Rejected dashes: {white}%d  {yellow}Dropped moves: {white}%d"),
+		                     DataPack.RejectedDashes, DataPack.DroppedMoves);
+	}
+	else
+	{
+		CanvasContext.Printf(TEXT("{red}Debug stats are compiled out (ADVANCEDMOVEMENT_WITH_DEBUG_STATS)"));
+	}
+	CanvasContext.Printf(TEXT("{yellow}Dash cooldown: {white}%s"), DataPack.DashCooldownRemaining > 0.f
+		                                                            ? *FString::Printf(
+			                                                            TEXT("%.2fs"), DataPack.DashCooldownRemaining)
+		                                                            : TEXT("ready"));
+
+	// Saved moves only exist on the owning client
+	const AAdvancedMovementCharacter* localCharacter = Cast<AAdvancedMovementCharacter>(FindLocalDebugActor());
+	const UAdvancedMovementComponent* localMovement = localCharacter
+		                                                  ? Cast<UAdvancedMovementComponent>(
+			                                                  localCharacter->GetCharacterMovement())
+		                                                  : nullptr;
+	if (localMovement && localCharacter->IsLocallyControlled())
+	{
+		CanvasContext.Printf(TEXT("{yellow}Pending saved moves: {white}%d"),
+		                     localMovement->GetNumPendingSavedMoves());
+#if ADVANCEDMOVEMENT_WITH_NET_STATS
+		const FAdvancedMovementNetStats& netStats = localMovement->GetNetStats();
+		CanvasContext.Printf(TEXT("{yellow}Moves: {white}%u created, %u combined, %u sent, %u acked  ")
+		                     TEXT("{yellow}ServerMove: {white}%.1f B avg"), netStats.MovesCreated,
+		                     netStats.MovesCombined, netStats.MovesSent, netStats.MovesAcked,
+		                     netStats.GetAverageServerMoveBytes());
+		CanvasContext.Printf(TEXT("{yellow}Combine refused: {white}sprint %u, slide %u, dash %u, stamina %u, ")
+		                     TEXT("cooldown %u, base %u"),
+		                     netStats.CombineRefusals[static_cast<uint8>(EAdvancedMovementCombineRefusal::Sprint)],
+		                     netStats.CombineRefusals[static_cast<uint8>(EAdvancedMovementCombineRefusal::Slide)],
+		                     netStats.CombineRefusals[static_cast<uint8>(EAdvancedMovementCombineRefusal::Dash)],
+		                     netStats.CombineRefusals[static_cast<uint8>(EAdvancedMovementCombineRefusal::Stamina)],
+		                     netStats.CombineRefusals[static_cast<uint8>(
+			                     EAdvancedMovementCombineRefusal::DashCooldown)],
+		                     netStats.CombineRefusals[static_cast<uint8>(EAdvancedMovementCombineRefusal::Base)]);
+#endif
+	}
+}
+
+#endif // WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,79 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "GameplayDebuggerCategory.h"
+
+/**
+ * @brief Gameplay debugger category of AAdvancedMovementCharacter.
+ *
+ * Collected on the server and replicated as a data pack, so a client can inspect characters simulated on a remote
+ * dedicated server. Pending saved moves are read locally, since they only exist on the owning client.
+ */
+class FGameplayDebuggerCategory_AdvancedMovement : public FGameplayDebuggerCategory
+{
+public:
+	FGameplayDebuggerCategory_AdvancedMovement();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	/**
+	 * @brief Creates the category, registered with IGameplayDebugger by the module.
+	 * 
+	 * @return The new category.
+	 */
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+protected:
+	/**
+	 * @brief Data replicated from the server.
+	 */
+	struct FRepData
+	{
+		/** Name of the current movement mode. */
+		FString ModeName;
+
+		/** Milliseconds spent in movement in the last frame. */
+		float MovementMs{0.f};
+
+		/** Ground traces issued in the last frame. */
+		int32 Traces{0};
+
+		/** Corrections in the last CorrectionWindow seconds. */
+		int32 RecentCorrections{0};
+
+		/** Corrections since the character spawned. */
+		int32 TotalCorrections{0};
+
+		/** Seconds until the dash is ready. */
+		float DashCooldownRemaining{0.f};
+
+		/** Dash requests rejected since the character spawned. */
+		int32 RejectedDashes{0};
+
+		/** Moves the server dropped since the character spawned. */
+		int32 DroppedMoves{0};
+
+		/** Significance tier on the server. */
+		uint8 SignificanceTier{0};
+
+		/** True if the server records debug stats. */
+		bool bHasStats{false};
+
+		void Serialize(FArchive& Ar);
+	};
+
+	/** 
+	 * @brief Seconds of corrections counted as recent.
+	 */
+	static constexpr float CorrectionWindow = 5.f;
+
+	FRepData DataPack;
+};
+
+#endif // WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,112 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Physics/AdvancedMovementAsyncCallback.h"
+
+#include "GameFramework/CharacterMovementComponent.h"
+
+void FAdvancedMovementAsyncCallback::OnPreSimulate_Internal()
+{
+	const float deltaTime = GetDeltaTime_Internal();
+	FAdvancedMovementAsyncOutput& output = GetProducerOutputData_Internal();
+
+	// Substeps of one game frame share its input, only the first one re-seeds the slides
+	const FAdvancedMovementAsyncInput* input = GetConsumerInput_Internal();
+	if (input && input->Frame != LastInputFrame)
+	{
+		LastInputFrame = input->Frame;
+
+		// The latest input is the authoritative set of sliding components
+		ActiveSlides = input->Slides;
+	}
+
+	if (deltaTime <= UE_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	output.Slides.Reserve(ActiveSlides.Num());
+	for (FAdvancedMovementAsyncSlideInput& slide : ActiveSlides)
+	{
+		IntegrateSlide(slide, deltaTime);
+		output.Slides.Add({slide.ComponentId, slide.Serial, slide.Velocity});
+	}
+}
+
+void FAdvancedMovementAsyncCallback::IntegrateSlide(FAdvancedMovementAsyncSlideInput& InSlide, float DeltaTime)
+{
+	InSlide.Velocity += FVector3f::DownVector * InSlide.GravityForce * DeltaTime;
+
+	// UCharacterMovementComponent::CalcVelocity without fluid friction and path following
+	const float maxSpeedSq = FMath::Square(InSlide.MaxSpeed);
+	const bool bZeroAcceleration = InSlide.Acceleration.IsZero();
+	const bool bVelocityOverMax = InSlide.Velocity.SizeSquared() > maxSpeedSq * 1.01f;
+	if (bZeroAcceleration || bVelocityOverMax)
+	{
+		const FVector3f oldVelocity = InSlide.Velocity;
+		ApplySlideBraking(InSlide, DeltaTime);
+
+		// Braking doesn't lower the speed below the max speed while accelerating forward
+		if (bVelocityOverMax && InSlide.Velocity.SizeSquared() < maxSpeedSq
+			&& (InSlide.Acceleration | oldVelocity) > 0.f)
+		{
+			InSlide.Velocity = oldVelocity.GetSafeNormal() * InSlide.MaxSpeed;
+		}
+	}
+	else
+	{
+		const FVector3f accelDir = InSlide.Acceleration.GetSafeNormal();
+		const float speed = InSlide.Velocity.Size();
+		InSlide.Velocity -= (InSlide.Velocity - accelDir * speed) * FMath::Min(DeltaTime * InSlide.Friction, 1.f);
+	}
+
+	if (!bZeroAcceleration)
+	{
+		const float maxInputSpeed = InSlide.Velocity.SizeSquared() > maxSpeedSq * 1.01f
+			                            ? InSlide.Velocity.Size()
+			                            : InSlide.MaxSpeed;
+		InSlide.Velocity += InSlide.Acceleration * DeltaTime;
+		InSlide.Velocity = InSlide.Velocity.GetClampedToMaxSize(maxInputSpeed);
+	}
+}
+
+void FAdvancedMovementAsyncCallback::ApplySlideBraking(FAdvancedMovementAsyncSlideInput& InSlide, float DeltaTime)
+{
+	const float friction = FMath::Max(0.f, InSlide.BrakingFriction);
+	const float brakingDeceleration = FMath::Max(0.f, InSlide.MaxBrakingDeceleration);
+	const bool bZeroFriction = friction == 0.f;
+	const bool bZeroBraking = brakingDeceleration == 0.f;
+	if (InSlide.Velocity.IsZero() || (bZeroFriction && bZeroBraking))
+	{
+		return;
+	}
+
+	const FVector3f oldVelocity = InSlide.Velocity;
+	const FVector3f reverseAcceleration = bZeroBraking
+		                                      ? FVector3f::ZeroVector
+		                                      : -brakingDeceleration * InSlide.Velocity.GetSafeNormal();
+	const float maxTimeStep = FMath::Clamp(InSlide.BrakingSubStepTime, 1.0f / 75.0f, 1.0f / 20.0f);
+
+	// Subdivided like the game thread, so large physics steps brake the same
+	float remainingTime = DeltaTime;
+	while (remainingTime >= UCharacterMovementComponent::MIN_TICK_TIME)
+	{
+		const float dt = remainingTime > maxTimeStep && !bZeroFriction
+			                 ? FMath::Min(maxTimeStep, remainingTime * 0.5f)
+			                 : remainingTime;
+		remainingTime -= dt;
+
+		InSlide.Velocity += (-friction * InSlide.Velocity + reverseAcceleration) * dt;
+		if ((InSlide.Velocity | oldVelocity) <= 0.f)
+		{
+			InSlide.Velocity = FVector3f::ZeroVector;
+			return;
+		}
+	}
+
+	const float speedSq = InSlide.Velocity.SizeSquared();
+	if (speedSq <= UE_KINDA_SMALL_NUMBER || (!bZeroBraking && speedSq <= FMath::Square(UCharacterMovementComponent::BRAKE_TO_STOP_VELOCITY)))
+	{
+		InSlide.Velocity = FVector3f::ZeroVector;
+	}
+}
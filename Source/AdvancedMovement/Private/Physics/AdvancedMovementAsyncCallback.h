@@ -0,0 +1,103 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+
+/**
+ * @brief Slide state submitted by the game thread for one component.
+ */
+struct FAdvancedMovementAsyncSlideInput
+{
+	uint32 ComponentId{0};
+	uint32 Serial{0};
+	FVector3f Velocity{FVector3f::ZeroVector};
+	FVector3f Acceleration{FVector3f::ZeroVector};
+	float GravityForce{0.f};
+	float Friction{0.f};
+	float BrakingFriction{0.f};
+	float MaxBrakingDeceleration{0.f};
+	float BrakingSubStepTime{0.f};
+	float MaxSpeed{0.f};
+};
+
+/**
+ * @brief Velocity computed on the physics thread for one component.
+ */
+struct FAdvancedMovementAsyncResult
+{
+	uint32 ComponentId{0};
+	uint32 Serial{0};
+	FVector3f Velocity{FVector3f::ZeroVector};
+};
+
+/**
+ * @brief Game thread to physics thread buffer. Slides holds every component currently sliding in async mode.
+ * Frame identifies the game frame that produced it, since substeps of one frame see the same input.
+ */
+struct FAdvancedMovementAsyncInput : public Chaos::FSimCallbackInput
+{
+	TArray<FAdvancedMovementAsyncSlideInput> Slides;
+	uint64 Frame{0};
+
+	void Reset()
+	{
+		Slides.Reset();
+		Frame = 0;
+	}
+};
+
+/**
+ * @brief Physics thread to game thread buffer, one per physics step.
+ */
+struct FAdvancedMovementAsyncOutput : public Chaos::FSimCallbackOutput
+{
+	TArray<FAdvancedMovementAsyncResult> Slides;
+
+	void Reset()
+	{
+		Slides.Reset();
+	}
+};
+
+/**
+ * @class FAdvancedMovementAsyncCallback
+ * @brief Integrates slide velocity at the fixed physics rate.
+ *
+ * Slide state persists between steps, so when physics runs several steps per game frame the velocity keeps
+ * integrating from the last submitted input.
+ */
+class FAdvancedMovementAsyncCallback : public Chaos::TSimCallbackObject<
+		FAdvancedMovementAsyncInput, FAdvancedMovementAsyncOutput>
+{
+protected:
+	virtual void OnPreSimulate_Internal() override;
+
+	/**
+	 * @brief Same shape as the game thread PhysSlide integration: surface gravity, then CalcVelocity.
+	 * 
+	 * @param InSlide The slide state, updated in place.
+	 * @param DeltaTime The physics step.
+	 */
+	static void IntegrateSlide(FAdvancedMovementAsyncSlideInput& InSlide, float DeltaTime);
+
+	/**
+	 * @brief Port of UCharacterMovementComponent::ApplyVelocityBraking, including its substeps.
+	 * 
+	 * @param InSlide The slide state, its velocity is updated in place.
+	 * @param DeltaTime The physics step.
+	 */
+	static void ApplySlideBraking(FAdvancedMovementAsyncSlideInput& InSlide, float DeltaTime);
+
+	/** 
+	 * @brief Slide state owned by the physics thread.
+	 */
+	TArray<FAdvancedMovementAsyncSlideInput> ActiveSlides;
+
+	/** 
+	 * @brief Frame of the last input applied to ActiveSlides.
+	 */
+	uint64 LastInputFrame{0};
+};
@@ -0,0 +1,22 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Settings/AdvancedMovementSettings.h"
+
+UAdvancedMovementSettings::UAdvancedMovementSettings()
+{
+	CategoryName = TEXT("Plugins");
+	SectionName = TEXT("AdvancedMovement");
+
+	SignificanceTierDistances = { 3000.f, 8000.f };
+	SignificanceTierTickIntervals = { 0.f, 0.05f, 0.15f };
+}
+
+float UAdvancedMovementSettings::GetTierTickInterval(uint8 Tier) const
+{
+	if (SignificanceTierTickIntervals.Num() == 0)
+	{
+		return 0.f;
+	}
+	return SignificanceTierTickIntervals[FMath::Min<int32>(Tier, SignificanceTierTickIntervals.Num() - 1)];
+}
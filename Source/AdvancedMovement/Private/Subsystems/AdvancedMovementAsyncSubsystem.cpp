@@ -0,0 +1,117 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Subsystems/AdvancedMovementAsyncSubsystem.h"
+
+#include "PBDRigidsSolver.h"
+#include "Engine/World.h"
+#include "Physics/AdvancedMovementAsyncCallback.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+
+void UAdvancedMovementAsyncSubsystem::Deinitialize()
+{
+	if (AsyncCallback)
+	{
+		if (FPhysScene* physScene = GetWorld()->GetPhysicsScene())
+		{
+			physScene->GetSolver()->UnregisterAndFreeSimCallbackObject_External(AsyncCallback);
+		}
+		AsyncCallback = nullptr;
+	}
+	SlideResults.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UAdvancedMovementAsyncSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UAdvancedMovementAsyncSubsystem::EnsureCallback()
+{
+	if (AsyncCallback)
+	{
+		return true;
+	}
+
+	FPhysScene* physScene = GetWorld()->GetPhysicsScene();
+	if (!physScene || !physScene->GetSolver())
+	{
+		return false;
+	}
+
+	AsyncCallback = physScene->GetSolver()->CreateAndRegisterSimCallbackObject_External<
+		FAdvancedMovementAsyncCallback>();
+	return AsyncCallback != nullptr;
+}
+
+void UAdvancedMovementAsyncSubsystem::SubmitSlide(uint32 ComponentId, uint32 Serial, const FVector& Velocity,
+                                                  const FVector& Acceleration, float GravityForce, float Friction,
+                                                  float BrakingFriction, float MaxBrakingDeceleration,
+                                                  float BrakingSubStepTime, float MaxSpeed)
+{
+	if (!EnsureCallback())
+	{
+		return;
+	}
+
+	FAdvancedMovementAsyncSlideInput slide;
+	slide.ComponentId = ComponentId;
+	slide.Serial = Serial;
+	slide.Velocity = FVector3f(Velocity);
+	slide.Acceleration = FVector3f(Acceleration);
+	slide.GravityForce = GravityForce;
+	slide.Friction = Friction;
+	slide.BrakingFriction = BrakingFriction;
+	slide.MaxBrakingDeceleration = MaxBrakingDeceleration;
+	slide.BrakingSubStepTime = BrakingSubStepTime;
+	slide.MaxSpeed = MaxSpeed;
+	FAdvancedMovementAsyncInput* input = AsyncCallback->GetProducerInputData_External();
+	input->Frame = GFrameCounter;
+	input->Slides.Add(slide);
+}
+
+bool UAdvancedMovementAsyncSubsystem::ConsumeSlideVelocity(uint32 ComponentId, uint32 Serial, FVector& OutVelocity)
+{
+	PullOutputs();
+
+	// Results still in flight from a previous slide never reach the next one
+	FSlideResult result;
+	if (!SlideResults.RemoveAndCopyValue(ComponentId, result) || result.Serial != Serial)
+	{
+		return false;
+	}
+	OutVelocity = FVector(result.Velocity);
+	return true;
+}
+
+void UAdvancedMovementAsyncSubsystem::EndSlide(uint32 ComponentId)
+{
+	SlideResults.Remove(ComponentId);
+
+	// Produce an input this frame even if nothing else slides, so the physics thread drops the slide
+	if (AsyncCallback)
+	{
+		AsyncCallback->GetProducerInputData_External()->Frame = GFrameCounter;
+	}
+}
+
+void UAdvancedMovementAsyncSubsystem::PullOutputs()
+{
+	if (!AsyncCallback || LastPullFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastPullFrame = GFrameCounter;
+
+	// Outputs come in step order, later steps overwrite earlier slide results
+	while (Chaos::TSimCallbackOutputHandle<FAdvancedMovementAsyncOutput> output = AsyncCallback->
+		PopFutureOutputData_External())
+	{
+		for (const FAdvancedMovementAsyncResult& result : output->Slides)
+		{
+			SlideResults.Add(result.ComponentId, {result.Serial, result.Velocity});
+		}
+	}
+}
@@ -0,0 +1,31 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Subsystems/AdvancedMovementEventSubsystem.h"
+
+#include "Settings/AdvancedMovementSettings.h"
+
+bool UAdvancedMovementEventSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && UAdvancedMovementSettings::Get()->bEnableEventStream;
+}
+
+void UAdvancedMovementEventSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const int32 capacity = UAdvancedMovementSettings::Get()->EventStreamCapacity;
+	EventStream = MakeShared<FAdvancedMovementEventStream, ESPMode::ThreadSafe>(static_cast<uint32>(FMath::Max(capacity, 64)));
+}
+
+void UAdvancedMovementEventSubsystem::Deinitialize()
+{
+	EventStream.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAdvancedMovementEventSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
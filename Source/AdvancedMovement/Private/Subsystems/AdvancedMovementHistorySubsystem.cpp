@@ -0,0 +1,258 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Subsystems/AdvancedMovementHistorySubsystem.h"
+
+#include "Actors/AdvancedMovementCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Settings/AdvancedMovementSettings.h"
+#include "Types/AdvancedMovementMemory.h"
+
+void UAdvancedMovementHistorySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	NumFrames = FMath::Max(UAdvancedMovementSettings::Get()->LagCompensationHistoryFrames, 2);
+	FrameTimes.SetNumZeroed(NumFrames);
+}
+
+void UAdvancedMovementHistorySubsystem::Deinitialize()
+{
+	SlotCharacters.Empty();
+	FreeSlots.Empty();
+	FrameTimes.Empty();
+	Locations.Empty();
+	Rotations.Empty();
+	CapsuleSizes.Empty();
+	MovementModes.Empty();
+	CustomMovementModes.Empty();
+	ValidFlags.Empty();
+	SlotCapacity = 0;
+
+	Super::Deinitialize();
+}
+
+bool UAdvancedMovementHistorySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAdvancedMovementHistorySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAdvancedMovementHistorySubsystem, STATGROUP_Tickables);
+}
+
+void UAdvancedMovementHistorySubsystem::RegisterCharacter(AAdvancedMovementCharacter* InCharacter)
+{
+	if (!IsValid(InCharacter) || SlotCharacters.Contains(InCharacter))
+	{
+		return;
+	}
+	LLM_SCOPE_BYTAG(AdvancedMovement);
+
+	if (FreeSlots.Num() == 0)
+	{
+		const int32 oldCapacity = SlotCapacity;
+		GrowSlots(FMath::Max(16, SlotCapacity * 2));
+		for (int32 slot = SlotCapacity - 1; slot >= oldCapacity; --slot)
+		{
+			FreeSlots.Add(slot);
+		}
+	}
+
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	const int32 slot = FreeSlots.Pop(false);
+#else
+	const int32 slot = FreeSlots.Pop(EAllowShrinking::No);
+#endif
+	SlotCharacters[slot] = InCharacter;
+}
+
+void UAdvancedMovementHistorySubsystem::UnregisterCharacter(AAdvancedMovementCharacter* InCharacter)
+{
+	const int32 slot = SlotCharacters.Find(InCharacter);
+	if (slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	SlotCharacters[slot] = nullptr;
+	FreeSlots.Add(slot);
+
+	// A reused slot must not expose the history of the previous character
+	for (int32 frame = 0; frame < NumFrames; ++frame)
+	{
+		ValidFlags[Index(frame, slot)] = 0;
+	}
+}
+
+void UAdvancedMovementHistorySubsystem::GrowSlots(int32 NewCapacity)
+{
+	const int32 oldCapacity = SlotCapacity;
+	const int32 numEntries = NumFrames * NewCapacity;
+
+	auto relayout = [this, oldCapacity, NewCapacity](auto& Array, auto DefaultValue)
+	{
+		TArray<TRemoveReference_T<decltype(Array[0])>> newArray;
+		newArray.Init(DefaultValue, NumFrames * NewCapacity);
+		for (int32 frame = 0; frame < NumFrames && oldCapacity > 0; ++frame)
+		{
+			FMemory::Memcpy(&newArray[frame * NewCapacity], &Array[frame * oldCapacity],
+			                oldCapacity * sizeof(DefaultValue));
+		}
+		Array = MoveTemp(newArray);
+	};
+
+	relayout(Locations, FVector::ZeroVector);
+	relayout(Rotations, FQuat4f::Identity);
+	relayout(CapsuleSizes, FVector2f::ZeroVector);
+	relayout(MovementModes, uint8(0));
+	relayout(CustomMovementModes, uint8(0));
+	relayout(ValidFlags, uint8(0));
+	check(ValidFlags.Num() == numEntries);
+
+	SlotCharacters.SetNum(NewCapacity);
+	SlotCapacity = NewCapacity;
+}
+
+void UAdvancedMovementHistorySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (SlotCapacity == 0 || FreeSlots.Num() == SlotCapacity)
+	{
+		return;
+	}
+
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_AdvancedMovement_RecordHistory);
+
+	const int32 frame = FrameHead;
+	FrameTimes[frame] = GetWorld()->GetTimeSeconds();
+
+	for (int32 slot = 0; slot < SlotCapacity; ++slot)
+	{
+		const int32 index = Index(frame, slot);
+		const AAdvancedMovementCharacter* character = SlotCharacters[slot];
+		if (!IsValid(character))
+		{
+			ValidFlags[index] = 0;
+			continue;
+		}
+
+		const UCapsuleComponent* capsule = character->GetCapsuleComponent();
+		const UCharacterMovementComponent* movement = character->GetCharacterMovement();
+		Locations[index] = capsule->GetComponentLocation();
+		Rotations[index] = FQuat4f(capsule->GetComponentQuat());
+		CapsuleSizes[index] = FVector2f(capsule->GetScaledCapsuleRadius(), capsule->GetScaledCapsuleHalfHeight());
+		MovementModes[index] = movement->MovementMode;
+		CustomMovementModes[index] = movement->CustomMovementMode;
+		ValidFlags[index] = 1;
+	}
+
+	FrameHead = (FrameHead + 1) % NumFrames;
+	NumRecordedFrames = FMath::Min(NumRecordedFrames + 1, NumFrames);
+}
+
+bool UAdvancedMovementHistorySubsystem::FindFrames(double ServerTime, int32& OutFrameA, int32& OutFrameB,
+                                                   float& OutAlpha) const
+{
+	if (NumRecordedFrames == 0)
+	{
+		return false;
+	}
+
+	// Walk from newest to oldest, frame times are monotonic
+	const int32 newest = (FrameHead - 1 + NumFrames) % NumFrames;
+	if (ServerTime >= FrameTimes[newest])
+	{
+		OutFrameA = OutFrameB = newest;
+		OutAlpha = 0.f;
+		return true;
+	}
+
+	int32 newer = newest;
+	for (int32 i = 1; i < NumRecordedFrames; ++i)
+	{
+		const int32 older = (newest - i + NumFrames) % NumFrames;
+		if (FrameTimes[older] <= ServerTime)
+		{
+			const double span = FrameTimes[newer] - FrameTimes[older];
+			OutFrameA = older;
+			OutFrameB = newer;
+			OutAlpha = span > UE_DOUBLE_SMALL_NUMBER ? static_cast<float>((ServerTime - FrameTimes[older]) / span) : 0.f;
+			return true;
+		}
+		newer = older;
+	}
+	return false;
+}
+
+bool UAdvancedMovementHistorySubsystem::SampleSlot(int32 Slot, int32 FrameA, int32 FrameB, float Alpha,
+                                                   FAdvancedMovementHistorySample& OutSample) const
+{
+	int32 a = Index(FrameA, Slot);
+	int32 b = Index(FrameB, Slot);
+	if (!ValidFlags[a] && !ValidFlags[b])
+	{
+		return false;
+	}
+	if (!ValidFlags[a])
+	{
+		a = b;
+	}
+	else if (!ValidFlags[b])
+	{
+		b = a;
+	}
+
+	OutSample.Time = FMath::Lerp(FrameTimes[FrameA], FrameTimes[FrameB], static_cast<double>(Alpha));
+	OutSample.Location = FMath::Lerp(Locations[a], Locations[b], static_cast<double>(Alpha));
+	OutSample.Rotation = FQuat(FQuat4f::Slerp(Rotations[a], Rotations[b], Alpha));
+	const FVector2f capsuleSize = FMath::Lerp(CapsuleSizes[a], CapsuleSizes[b], Alpha);
+	OutSample.CapsuleRadius = capsuleSize.X;
+	OutSample.CapsuleHalfHeight = capsuleSize.Y;
+	const int32 nearest = Alpha < .5f ? a : b;
+	OutSample.MovementMode = static_cast<EMovementMode>(MovementModes[nearest]);
+	OutSample.CustomMovementMode = CustomMovementModes[nearest];
+	return true;
+}
+
+bool UAdvancedMovementHistorySubsystem::GetSampleAtTime(const AAdvancedMovementCharacter* InCharacter,
+                                                        double ServerTime,
+                                                        FAdvancedMovementHistorySample& OutSample) const
+{
+	const int32 slot = SlotCharacters.Find(const_cast<AAdvancedMovementCharacter*>(InCharacter));
+	int32 frameA, frameB;
+	float alpha;
+	return slot != INDEX_NONE
+		&& FindFrames(ServerTime, frameA, frameB, alpha)
+		&& SampleSlot(slot, frameA, frameB, alpha, OutSample);
+}
+
+int32 UAdvancedMovementHistorySubsystem::ForEachSampleAtTime(
+	double ServerTime,
+	TFunctionRef<void(AAdvancedMovementCharacter*, const FAdvancedMovementHistorySample&)> InFunction) const
+{
+	int32 frameA, frameB;
+	float alpha;
+	if (!FindFrames(ServerTime, frameA, frameB, alpha))
+	{
+		return 0;
+	}
+
+	int32 count = 0;
+	FAdvancedMovementHistorySample sample;
+	for (int32 slot = 0; slot < SlotCapacity; ++slot)
+	{
+		AAdvancedMovementCharacter* character = SlotCharacters[slot];
+		if (IsValid(character) && SampleSlot(slot, frameA, frameB, alpha, sample))
+		{
+			InFunction(character, sample);
+			++count;
+		}
+	}
+	return count;
+}
@@ -0,0 +1,133 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Subsystems/AdvancedMovementSignificanceSubsystem.h"
+
+#include "Components/AdvancedMovementComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Settings/AdvancedMovementSettings.h"
+#include "Types/AdvancedMovementMemory.h"
+
+bool UAdvancedMovementSignificanceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer)
+		&& IsRunningDedicatedServer()
+		&& UAdvancedMovementSettings::Get()->bEnableSignificanceGovernor;
+}
+
+void UAdvancedMovementSignificanceSubsystem::Deinitialize()
+{
+	Components.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UAdvancedMovementSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game;
+}
+
+TStatId UAdvancedMovementSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAdvancedMovementSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UAdvancedMovementSignificanceSubsystem::RegisterComponent(UAdvancedMovementComponent* InComponent)
+{
+	if (IsValid(InComponent))
+	{
+		LLM_SCOPE_BYTAG(AdvancedMovement);
+		Components.AddUnique(InComponent);
+	}
+}
+
+void UAdvancedMovementSignificanceSubsystem::UnregisterComponent(UAdvancedMovementComponent* InComponent)
+{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+	Components.RemoveSingleSwap(InComponent, false);
+#else
+	Components.RemoveSingleSwap(InComponent, EAllowShrinking::No);
+#endif
+}
+
+bool UAdvancedMovementSignificanceSubsystem::TryConsumeGroundProbe()
+{
+	if (GroundProbesLeft <= 0)
+	{
+		return false;
+	}
+	--GroundProbesLeft;
+	return true;
+}
+
+void UAdvancedMovementSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Ticks after the actors, so the budget is refilled for the next frame
+	const UAdvancedMovementSettings* settings = UAdvancedMovementSettings::Get();
+	GroundProbesLeft = settings->GroundProbeBudgetPerFrame;
+
+	TimeUntilTierUpdate -= DeltaTime;
+	if (TimeUntilTierUpdate <= 0.f)
+	{
+		TimeUntilTierUpdate = settings->SignificanceUpdateInterval;
+		UpdateTiers();
+	}
+}
+
+void UAdvancedMovementSignificanceSubsystem::UpdateTiers()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_AdvancedMovement_UpdateSignificance);
+
+	TArray<FVector, TInlineAllocator<64>> playerLocations;
+	for (FConstPlayerControllerIterator it = GetWorld()->GetPlayerControllerIterator(); it; ++it)
+	{
+		const APlayerController* pc = it->Get();
+		if (pc && pc->GetPawn())
+		{
+			playerLocations.Add(pc->GetPawn()->GetActorLocation());
+		}
+	}
+
+	const TArray<float>& tierDistances = UAdvancedMovementSettings::Get()->SignificanceTierDistances;
+
+	for (int32 i = Components.Num() - 1; i >= 0; --i)
+	{
+		UAdvancedMovementComponent* component = Components[i];
+		if (!IsValid(component))
+		{
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+			Components.RemoveAtSwap(i, 1, false);
+#else
+			Components.RemoveAtSwap(i, 1, EAllowShrinking::No);
+#endif
+			continue;
+		}
+
+		const APawn* pawn = component->GetPawnOwner();
+		if (!pawn || pawn->IsPlayerControlled())
+		{
+			component->SetSignificanceTier(0);
+			continue;
+		}
+
+		// Without any player every AI character drops to the last tier
+		double minDistSq = TNumericLimits<double>::Max();
+		const FVector location = pawn->GetActorLocation();
+		for (const FVector& playerLocation : playerLocations)
+		{
+			minDistSq = FMath::Min(minDistSq, FVector::DistSquared(location, playerLocation));
+		}
+
+		uint8 tier = 0;
+		while (tier < tierDistances.Num() && minDistSq > FMath::Square(static_cast<double>(tierDistances[tier])))
+		{
+			++tier;
+		}
+		component->SetSignificanceTier(tier);
+	}
+}
@@ -0,0 +1,169 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Subsystems/AdvancedMovementTickSubsystem.h"
+
+#include "Components/AdvancedMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Types/AdvancedMovementMemory.h"
+
+void FAdvancedMovementBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType,
+                                                     ENamedThreads::Type CurrentThread,
+                                                     const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->TickComponents(DeltaTime, TickType);
+	}
+}
+
+FString FAdvancedMovementBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("FAdvancedMovementBatchTickFunction");
+}
+
+FName FAdvancedMovementBatchTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("AdvancedMovementBatchTick"));
+}
+
+void UAdvancedMovementTickSubsystem::Deinitialize()
+{
+	if (BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.UnRegisterTickFunction();
+	}
+	BatchTickFunction.Subsystem = nullptr;
+	Components.Empty();
+	AccumulatedTimes.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UAdvancedMovementTickSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAdvancedMovementTickSubsystem::RegisterComponent(UAdvancedMovementComponent* InComponent)
+{
+	if (!IsValid(InComponent) || Components.Contains(InComponent))
+	{
+		return;
+	}
+	LLM_SCOPE_BYTAG(AdvancedMovement);
+
+	if (!BatchTickFunction.IsTickFunctionRegistered())
+	{
+		// Same group as the per-component CMC tick it replaces
+		BatchTickFunction.Subsystem = this;
+		BatchTickFunction.bCanEverTick = true;
+		BatchTickFunction.bStartWithTickEnabled = true;
+		BatchTickFunction.bRunOnAnyThread = false;
+		BatchTickFunction.TickGroup = TG_PrePhysics;
+		BatchTickFunction.EndTickGroup = TG_PrePhysics;
+		BatchTickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+	}
+
+	Components.Add(InComponent);
+	AccumulatedTimes.Add(0.f);
+	InComponent->bAutoUpdateTickRegistration = false;
+	InComponent->SetComponentTickEnabled(false);
+
+	// ACharacter makes the mesh wait for the movement tick, a wait on a disabled tick is skipped
+	const ACharacter* character = InComponent->GetCharacterOwner();
+	if (character && character->GetMesh())
+	{
+		character->GetMesh()->PrimaryComponentTick.AddPrerequisite(this, BatchTickFunction);
+	}
+}
+
+void UAdvancedMovementTickSubsystem::UnregisterComponent(UAdvancedMovementComponent* InComponent)
+{
+	const int32 index = Components.Find(InComponent);
+	if (index == INDEX_NONE)
+	{
+		return;
+	}
+
+	const ACharacter* character = InComponent->GetCharacterOwner();
+	if (character && character->GetMesh())
+	{
+		character->GetMesh()->PrimaryComponentTick.RemovePrerequisite(this, BatchTickFunction);
+	}
+
+	// Keep the order stable, the slot is compacted on the next tick
+	Components[index] = nullptr;
+	bHasStaleEntries = true;
+}
+
+void UAdvancedMovementTickSubsystem::AddControllerPrerequisite(AController* InController)
+{
+	if (IsValid(InController) && BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.AddPrerequisite(InController, InController->PrimaryActorTick);
+	}
+}
+
+void UAdvancedMovementTickSubsystem::RemoveControllerPrerequisite(AController* InController)
+{
+	if (IsValid(InController) && BatchTickFunction.IsTickFunctionRegistered())
+	{
+		BatchTickFunction.RemovePrerequisite(InController, InController->PrimaryActorTick);
+	}
+}
+
+void UAdvancedMovementTickSubsystem::TickComponents(float DeltaTime, ELevelTick TickType)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_AdvancedMovement_BatchedTick);
+
+	if (bHasStaleEntries)
+	{
+		int32 writeIndex = 0;
+		for (int32 readIndex = 0; readIndex < Components.Num(); ++readIndex)
+		{
+			if (Components[readIndex] != nullptr)
+			{
+				Components[writeIndex] = Components[readIndex];
+				AccumulatedTimes[writeIndex] = AccumulatedTimes[readIndex];
+				++writeIndex;
+			}
+		}
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+		Components.SetNum(writeIndex, false);
+		AccumulatedTimes.SetNum(writeIndex, false);
+#else
+		Components.SetNum(writeIndex, EAllowShrinking::No);
+		AccumulatedTimes.SetNum(writeIndex, EAllowShrinking::No);
+#endif
+		bHasStaleEntries = false;
+	}
+
+	// Index loop: components may unregister (null their slot) or register (append) while ticking
+	for (int32 i = 0; i < Components.Num(); ++i)
+	{
+		UAdvancedMovementComponent* component = Components[i];
+		if (!IsValid(component) || !component->IsRegistered() || !component->IsActive())
+		{
+			continue;
+		}
+
+		const AActor* owner = component->GetOwner();
+		const float dilatedTime = owner ? DeltaTime * owner->CustomTimeDilation : DeltaTime;
+
+		float& accumulatedTime = AccumulatedTimes[i];
+		accumulatedTime += dilatedTime;
+		if (accumulatedTime < component->GetComponentTickInterval())
+		{
+			continue;
+		}
+
+		const float tickTime = accumulatedTime;
+		accumulatedTime = 0.f;
+		component->TickComponent(tickTime, TickType, &component->PrimaryComponentTick);
+	}
+}
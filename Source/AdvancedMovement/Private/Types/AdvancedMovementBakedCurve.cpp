@@ -0,0 +1,25 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementBakedCurve.h"
+#include "Curves/CurveFloat.h"
+
+void FAdvancedMovementBakedCurve::Bake(const UCurveFloat* InCurve, float InDefaultValue)
+{
+	DefaultValue = InDefaultValue;
+	bBaked = InCurve != nullptr;
+	if (!bBaked)
+	{
+		return;
+	}
+
+	float maxTime;
+	InCurve->GetTimeRange(MinTime, maxTime);
+	const float sampleStep = (maxTime - MinTime) / (NumSamples - 1);
+	InvSampleStep = sampleStep > UE_KINDA_SMALL_NUMBER ? 1.f / sampleStep : 0.f;
+
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		Samples[i] = InCurve->GetFloatValue(MinTime + sampleStep * i);
+	}
+}
@@ -0,0 +1,39 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementDebugStats.h"
+
+void FAdvancedMovementDebugStats::BeginFrame(uint64 InFrame)
+{
+	if (Frame == InFrame)
+	{
+		return;
+	}
+
+	// Values of an older frame than the previous one are stale
+	const bool bPreviousFrame = Frame + 1 == InFrame;
+	MovementMsLastFrame = bPreviousFrame
+		                      ? static_cast<float>(FPlatformTime::ToMilliseconds64(MovementCyclesThisFrame))
+		                      : 0.f;
+	TracesLastFrame = bPreviousFrame ? TracesThisFrame : 0;
+	MovementCyclesThisFrame = 0;
+	TracesThisFrame = 0;
+	Frame = InFrame;
+}
+
+void FAdvancedMovementDebugStats::AddCorrection(double InWorldTime)
+{
+	CorrectionTimes[NumCorrections % MaxCorrectionTimes] = InWorldTime;
+	++NumCorrections;
+}
+
+int32 FAdvancedMovementDebugStats::CountCorrectionsSince(double InWorldTime) const
+{
+	int32 count = 0;
+	const int32 numKept = FMath::Min(NumCorrections, MaxCorrectionTimes);
+	for (int32 i = 0; i < numKept; ++i)
+	{
+		count += CorrectionTimes[i] >= InWorldTime ? 1 : 0;
+	}
+	return count;
+}
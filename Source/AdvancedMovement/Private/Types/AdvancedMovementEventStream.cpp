@@ -0,0 +1,50 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementEventStream.h"
+
+FAdvancedMovementEventStream::FAdvancedMovementEventStream(uint32 InCapacity)
+{
+	const uint32 capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+	Buffer.SetNum(capacity);
+	Mask = capacity - 1;
+}
+
+bool FAdvancedMovementEventStream::Push(const FAdvancedMovementEvent& InEvent)
+{
+	const uint64 head = Head.load(std::memory_order_relaxed);
+	const uint64 tail = Tail.load(std::memory_order_acquire);
+	if (head - tail > Mask)
+	{
+		NumDropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	Buffer[head & Mask] = InEvent;
+	Head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+int32 FAdvancedMovementEventStream::Drain(TArray<FAdvancedMovementEvent>& OutEvents, int32 MaxEvents)
+{
+	bool bExpected = false;
+	if (!bDraining.compare_exchange_strong(bExpected, true, std::memory_order_acquire))
+	{
+		// Another consumer is draining, it will pick these up
+		return 0;
+	}
+
+	const uint64 tail = Tail.load(std::memory_order_relaxed);
+	const uint64 head = Head.load(std::memory_order_acquire);
+	const int32 count = static_cast<int32>(FMath::Min<uint64>(head - tail, static_cast<uint64>(FMath::Max(MaxEvents, 0))));
+
+	OutEvents.Reserve(OutEvents.Num() + count);
+	for (int32 i = 0; i < count; ++i)
+	{
+		OutEvents.Add(Buffer[(tail + i) & Mask]);
+	}
+
+	Tail.store(tail + count, std::memory_order_release);
+	bDraining.store(false, std::memory_order_release);
+	return count;
+}
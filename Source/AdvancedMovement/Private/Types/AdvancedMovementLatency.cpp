@@ -0,0 +1,125 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementLatency.h"
+
+CSV_DEFINE_CATEGORY(AdvancedMovementLatency, true);
+
+void FAdvancedMovementLatencyHistogram::Add(float InMs)
+{
+	int32 bucket = 0;
+	while (bucket < NumBuckets - 1 && InMs > BucketUpperMs[bucket])
+	{
+		++bucket;
+	}
+	++Counts[bucket];
+	++NumSamples;
+	TotalMs += InMs;
+	MaxMs = FMath::Max(MaxMs, InMs);
+}
+
+void FAdvancedMovementLatencyHistogram::Reset()
+{
+	*this = FAdvancedMovementLatencyHistogram();
+}
+
+FString FAdvancedMovementLatencyHistogram::ToString() const
+{
+	FString result = FString::Printf(TEXT("%u %.1f %.1f |"), NumSamples,
+	                                 NumSamples > 0 ? TotalMs / NumSamples : 0.0, MaxMs);
+	for (int32 i = 0; i < NumBuckets; ++i)
+	{
+		if (i < NumBuckets - 1)
+		{
+			result += FString::Printf(TEXT(" %.0f:%u"), BucketUpperMs[i], Counts[i]);
+		}
+		else
+		{
+			result += FString::Printf(TEXT(" inf:%u"), Counts[i]);
+		}
+	}
+	return result;
+}
+
+FAdvancedMovementLatencyStats& FAdvancedMovementLatencyStats::Get()
+{
+	static FAdvancedMovementLatencyStats Instance;
+	return Instance;
+}
+
+void FAdvancedMovementLatencyStats::AddSample(EAdvancedMovementInput InInput, bool bInServer, float InMs)
+{
+	check(IsInGameThread());
+	Histograms[bInServer ? 1 : 0][static_cast<uint8>(InInput)].Add(InMs);
+
+	switch (InInput)
+	{
+	case EAdvancedMovementInput::Sprint:
+		if (bInServer)
+		{
+			CSV_CUSTOM_STAT(AdvancedMovementLatency, ServerSprintMs, InMs, ECsvCustomStatOp::Max);
+		}
+		else
+		{
+			CSV_CUSTOM_STAT(AdvancedMovementLatency, ClientSprintMs, InMs, ECsvCustomStatOp::Max);
+		}
+		break;
+	case EAdvancedMovementInput::Slide:
+		if (bInServer)
+		{
+			CSV_CUSTOM_STAT(AdvancedMovementLatency, ServerSlideMs, InMs, ECsvCustomStatOp::Max);
+		}
+		else
+		{
+			CSV_CUSTOM_STAT(AdvancedMovementLatency, ClientSlideMs, InMs, ECsvCustomStatOp::Max);
+		}
+		break;
+	case EAdvancedMovementInput::Dash:
+		if (bInServer)
+		{
+			CSV_CUSTOM_STAT(AdvancedMovementLatency, ServerDashMs, InMs, ECsvCustomStatOp::Max);
+		}
+		else
+		{
+			CSV_CUSTOM_STAT(AdvancedMovementLatency, ClientDashMs, InMs, ECsvCustomStatOp::Max);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+const FAdvancedMovementLatencyHistogram& FAdvancedMovementLatencyStats::GetHistogram(EAdvancedMovementInput InInput,
+	bool bInServer) const
+{
+	return Histograms[bInServer ? 1 : 0][static_cast<uint8>(InInput)];
+}
+
+void FAdvancedMovementLatencyStats::Reset()
+{
+	for (FAdvancedMovementLatencyHistogram(&side)[static_cast<uint8>(EAdvancedMovementInput::MAX)] : Histograms)
+	{
+		for (FAdvancedMovementLatencyHistogram& histogram : side)
+		{
+			histogram.Reset();
+		}
+	}
+}
+
+void FAdvancedMovementLatencyStats::WriteCsvMetadata() const
+{
+#if CSV_PROFILER
+	static const TCHAR* InputNames[] = {TEXT("Sprint"), TEXT("Slide"), TEXT("Dash")};
+	static_assert(UE_ARRAY_COUNT(InputNames) == static_cast<uint8>(EAdvancedMovementInput::MAX));
+
+	for (int32 side = 0; side < 2; ++side)
+	{
+		for (int32 input = 0; input < UE_ARRAY_COUNT(InputNames); ++input)
+		{
+			const FString key = FString::Printf(TEXT("AdvancedMovement%s%sLatency"),
+			                                    side == 0 ? TEXT("Client") : TEXT("Server"), InputNames[input]);
+			CSV_METADATA(*key, *Histograms[side][input].ToString());
+		}
+	}
+#endif
+}
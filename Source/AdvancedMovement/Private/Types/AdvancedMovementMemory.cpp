@@ -0,0 +1,79 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementMemory.h"
+#include "EngineUtils.h"
+#include "Actors/AdvancedMovementCharacter.h"
+#include "Components/AdvancedMovementComponent.h"
+#include "Serialization/ArchiveCountMem.h"
+
+LLM_DEFINE_TAG(AdvancedMovement);
+LLM_DEFINE_TAG(AdvancedMovement_Prediction, TEXT("Prediction"), TEXT("AdvancedMovement"));
+LLM_DEFINE_TAG(AdvancedMovement_SavedMoves, TEXT("SavedMoves"), TEXT("AdvancedMovement"));
+LLM_DEFINE_TAG(AdvancedMovement_QueryParams, TEXT("QueryParams"), TEXT("AdvancedMovement"));
+LLM_DEFINE_TAG(AdvancedMovement_Delegates, TEXT("Delegates"), TEXT("AdvancedMovement"));
+
+namespace AdvancedMovementMemory
+{
+	/** Bytes of an object and the containers it serializes, like obj list. */
+	static SIZE_T GetObjectBytes(UObject* InObject)
+	{
+		FArchiveCountMem countMem(InObject);
+		return countMem.GetMax();
+	}
+
+	static void MemReport(const TArray<FString>& InArgs, UWorld* InWorld, FOutputDevice& InAr)
+	{
+		if (!InWorld)
+		{
+			return;
+		}
+
+		const bool bSummaryOnly = InArgs.Contains(TEXT("-summary"));
+		SIZE_T totalCharacter = 0;
+		SIZE_T totalComponent = 0;
+		SIZE_T totalPrediction = 0;
+		int32 numCharacters = 0;
+
+		InAr.Logf(TEXT("AdvancedMovement memory, %s"), *InWorld->GetName());
+		if (!bSummaryOnly)
+		{
+			InAr.Logf(TEXT("%-48s %10s %10s %10s %10s"), TEXT("Character"), TEXT("Actor"), TEXT("Movement"),
+			          TEXT("Prediction"), TEXT("Total"));
+		}
+
+		for (TActorIterator<AAdvancedMovementCharacter> it(InWorld); it; ++it)
+		{
+			AAdvancedMovementCharacter* character = *it;
+			const UAdvancedMovementComponent* movement = Cast<UAdvancedMovementComponent>(
+				character->GetCharacterMovement());
+			const SIZE_T characterBytes = GetObjectBytes(character);
+			const SIZE_T componentBytes = movement ? GetObjectBytes(const_cast<UAdvancedMovementComponent*>(movement)) : 0;
+			const SIZE_T predictionBytes = movement ? movement->GetPredictionDataAllocatedSize() : 0;
+
+			if (!bSummaryOnly)
+			{
+				InAr.Logf(TEXT("%-48s %10llu %10llu %10llu %10llu"), *character->GetName(),
+				          static_cast<uint64>(characterBytes), static_cast<uint64>(componentBytes),
+				          static_cast<uint64>(predictionBytes),
+				          static_cast<uint64>(characterBytes + componentBytes + predictionBytes));
+			}
+
+			totalCharacter += characterBytes;
+			totalComponent += componentBytes;
+			totalPrediction += predictionBytes;
+			++numCharacters;
+		}
+
+		InAr.Logf(TEXT("%d characters, actor %llu, movement %llu, prediction %llu, total %llu bytes"), numCharacters,
+		          static_cast<uint64>(totalCharacter), static_cast<uint64>(totalComponent),
+		          static_cast<uint64>(totalPrediction),
+		          static_cast<uint64>(totalCharacter + totalComponent + totalPrediction));
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("am.MemReport"),
+		TEXT("Prints the memory of every AAdvancedMovementCharacter, its movement component and prediction data. ")
+		TEXT("-summary prints the totals only."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&MemReport));
+}
@@ -0,0 +1,78 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementNetStats.h"
+
+CSV_DEFINE_CATEGORY(AdvancedMovementNet, true);
+
+void FAdvancedMovementNetStats::RecordCreated()
+{
+	++MovesCreated;
+	CSV_CUSTOM_STAT(AdvancedMovementNet, MovesCreated, 1, ECsvCustomStatOp::Accumulate);
+}
+
+void FAdvancedMovementNetStats::RecordCombined()
+{
+	++MovesCombined;
+	CSV_CUSTOM_STAT(AdvancedMovementNet, MovesCombined, 1, ECsvCustomStatOp::Accumulate);
+}
+
+void FAdvancedMovementNetStats::RecordRefusal(EAdvancedMovementCombineRefusal InReason)
+{
+	++CombineRefusals[static_cast<uint8>(InReason)];
+
+	switch (InReason)
+	{
+	case EAdvancedMovementCombineRefusal::Sprint:
+		CSV_CUSTOM_STAT(AdvancedMovementNet, CombineRefusedSprint, 1, ECsvCustomStatOp::Accumulate);
+		break;
+	case EAdvancedMovementCombineRefusal::Slide:
+		CSV_CUSTOM_STAT(AdvancedMovementNet, CombineRefusedSlide, 1, ECsvCustomStatOp::Accumulate);
+		break;
+	case EAdvancedMovementCombineRefusal::Dash:
+		CSV_CUSTOM_STAT(AdvancedMovementNet, CombineRefusedDash, 1, ECsvCustomStatOp::Accumulate);
+		break;
+	case EAdvancedMovementCombineRefusal::Stamina:
+		CSV_CUSTOM_STAT(AdvancedMovementNet, CombineRefusedStamina, 1, ECsvCustomStatOp::Accumulate);
+		break;
+	case EAdvancedMovementCombineRefusal::DashCooldown:
+		CSV_CUSTOM_STAT(AdvancedMovementNet, CombineRefusedDashCooldown, 1, ECsvCustomStatOp::Accumulate);
+		break;
+	case EAdvancedMovementCombineRefusal::Base:
+		CSV_CUSTOM_STAT(AdvancedMovementNet, CombineRefusedBase, 1, ECsvCustomStatOp::Accumulate);
+		break;
+	default:
+		break;
+	}
+}
+
+void FAdvancedMovementNetStats::RecordSent(int32 InNumMoves)
+{
+	MovesSent += InNumMoves;
+	CSV_CUSTOM_STAT(AdvancedMovementNet, MovesSent, InNumMoves, ECsvCustomStatOp::Accumulate);
+}
+
+void FAdvancedMovementNetStats::RecordServerMovePacket(int32 InBytes)
+{
+	++ServerMovePackets;
+	ServerMoveBytes += InBytes;
+	CSV_CUSTOM_STAT(AdvancedMovementNet, ServerMovePackets, 1, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(AdvancedMovementNet, ServerMoveBytes, InBytes, ECsvCustomStatOp::Accumulate);
+}
+
+void FAdvancedMovementNetStats::RecordAcked(int32 InNumMoves)
+{
+	MovesAcked += InNumMoves;
+	CSV_CUSTOM_STAT(AdvancedMovementNet, MovesAcked, InNumMoves, ECsvCustomStatOp::Accumulate);
+}
+
+void FAdvancedMovementNetStats::RecordDropped()
+{
+	++MovesDropped;
+	CSV_CUSTOM_STAT(AdvancedMovementNet, MovesDropped, 1, ECsvCustomStatOp::Accumulate);
+}
+
+float FAdvancedMovementNetStats::GetAverageServerMoveBytes() const
+{
+	return ServerMovePackets > 0 ? static_cast<float>(static_cast<double>(ServerMoveBytes) / ServerMovePackets) : 0.f;
+}
@@ -0,0 +1,59 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+
+#include "Types/AdvancedMovementRootMotion.h"
+
+#include "Curves/CurveFloat.h"
+#include "Engine/NetSerialization.h"
+
+FRootMotionSource_AdvancedDash::FRootMotionSource_AdvancedDash()
+{
+	AccumulateMode = ERootMotionAccumulateMode::Override;
+}
+
+FRootMotionSource* FRootMotionSource_AdvancedDash::Clone() const
+{
+	return new FRootMotionSource_AdvancedDash(*this);
+}
+
+bool FRootMotionSource_AdvancedDash::Matches(const FRootMotionSource* Other) const
+{
+	if (!FRootMotionSource_ConstantForce::Matches(Other))
+	{
+		return false;
+	}
+
+	// Matches() already guarantees the same script struct
+	const FRootMotionSource_AdvancedDash* otherCast = static_cast<const FRootMotionSource_AdvancedDash*>(Other);
+	return DashDirection == otherCast->DashDirection;
+}
+
+bool FRootMotionSource_AdvancedDash::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// Skip the constant force serializer, it writes the force at full precision
+	if (!FRootMotionSource::NetSerialize(Ar, Map, bOutSuccess))
+	{
+		return false;
+	}
+
+	FVector_NetQuantize10 quantizedForce(Force);
+	quantizedForce.NetSerialize(Ar, Map, bOutSuccess);
+	Force = quantizedForce;
+
+	Ar << DashDirection;
+	Ar << StrengthOverTime;
+
+	bOutSuccess = true;
+	return true;
+}
+
+UScriptStruct* FRootMotionSource_AdvancedDash::GetScriptStruct() const
+{
+	return FRootMotionSource_AdvancedDash::StaticStruct();
+}
+
+FString FRootMotionSource_AdvancedDash::ToSimpleString() const
+{
+	return FString::Printf(TEXT("[ID:%u]FRootMotionSource_AdvancedDash %s Direction %u"), LocalID,
+	                       *InstanceName.GetPlainNameString(), DashDirection);
+}
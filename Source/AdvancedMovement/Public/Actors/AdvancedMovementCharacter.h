@@ -4,8 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "GameplayTagContainer.h"
 #include "AdvancedMovementCharacter.generated.h"
 
+/**
+ * @brief Abilities of UAdvancedMovementComponent that gameplay code can block.
+ */
+UENUM(BlueprintType, meta=(Bitflags, UseEnumValuesAsMaskValuesInEditor="true"))
+enum class EAdvancedMovementAbility : uint8
+{
+	None = 0 UMETA(Hidden),
+	Sprint = 1 << 0, /**< Sprinting. */
+	Slide = 1 << 1, /**< Sliding. */
+	Dash = 1 << 2 /**< Dashing. */
+};
+ENUM_CLASS_FLAGS(EAdvancedMovementAbility)
+
 /**
  * @brief A character class for handling advanced movement features.
  * 
@@ -42,11 +56,57 @@ protected:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="AAdvancedMovementCharacter|Movement|Slide")
 	float SlideMaxYawView{ 20.0f };
 
+	/**
+	 * @brief Owned tags that block sprinting, see UpdateBlockedAbilitiesFromTags.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	FGameplayTagContainer SprintBlockingTags;
+
+	/**
+	 * @brief Owned tags that block sliding, see UpdateBlockedAbilitiesFromTags.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	FGameplayTagContainer SlideBlockingTags;
+
+	/**
+	 * @brief Owned tags that block dashing, see UpdateBlockedAbilitiesFromTags.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	FGameplayTagContainer DashBlockingTags;
+
+	/**
+	 * @brief Blocked abilities, a mask of EAdvancedMovementAbility read by the movement hot path.
+	 * Replicated so the owning client predicts with the server's gates.
+	 */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category="AAdvancedMovementCharacter|Movement|Abilities",
+		meta=(Bitmask, BitmaskEnum="/Script/AdvancedMovement.EAdvancedMovementAbility"))
+	uint8 BlockedAbilities{0};
+
+	/**
+	 * @brief Abilities blocked through SetAbilityBlocked.
+	 */
+	uint8 ExplicitBlockedAbilities{0};
+
+	/**
+	 * @brief Abilities blocked through UpdateBlockedAbilitiesFromTags.
+	 */
+	uint8 TagBlockedAbilities{0};
+
+	/**
+	 * @brief Abilities blocked through RefreshAbilityGates.
+	 */
+	uint8 GateBlockedAbilities{0};
+
 protected:
 
 
 public:
 
+	virtual void PostInitializeComponents() override;
+	virtual void NotifyControllerChanged() override;
+	virtual void PawnClientRestart() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
 
 	/**
@@ -156,9 +216,56 @@ public:
 	 */
 	FCollisionQueryParams GetIgnoreCharacterParams() const;
 
+	/**
+	 * @brief Checks if an ability is blocked. A single bit test, safe to call per move.
+	 * 
+	 * @param InAbility The ability.
+	 * @return True if the ability is blocked, otherwise false.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	bool IsAbilityBlocked(EAdvancedMovementAbility InAbility) const
+	{
+		return (BlockedAbilities & static_cast<uint8>(InAbility)) != 0;
+	}
+
+	/**
+	 * @brief Blocks or unblocks an ability. Call on the server when the gameplay condition changes.
+	 * 
+	 * @param InAbility The ability.
+	 * @param bInBlocked True to block the ability.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	void SetAbilityBlocked(EAdvancedMovementAbility InAbility, bool bInBlocked);
+
+	/**
+	 * @brief Blocks the abilities whose blocking tags intersect the owned tags, e.g. from a gameplay tag change
+	 * event of an ability system component.
+	 * 
+	 * @param InOwnedTags The tags owned by the character.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	void UpdateBlockedAbilitiesFromTags(const FGameplayTagContainer& InOwnedTags);
+
+	/**
+	 * @brief Evaluates CanSprint and CanDash once and stores the result in the blocked ability mask, separately
+	 * from the explicit and tag blocks. Call when the conditions of an override change, the movement component never calls them itself.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="AAdvancedMovementCharacter|Movement|Abilities")
+	void RefreshAbilityGates();
+
+	/**
+	 * @brief Gate of the dash, evaluated by RefreshAbilityGates.
+	 * 
+	 * @return True if dashing is allowed.
+	 */
 	UFUNCTION(BlueprintNativeEvent, Category="AAdvancedMovementCharacter|Movement")
 	bool CanDash();
 
+	/**
+	 * @brief Gate of the sprint, evaluated by RefreshAbilityGates.
+	 * 
+	 * @return True if sprinting is allowed.
+	 */
 	UFUNCTION(BlueprintNativeEvent, Category="AAdvancedMovementCharacter|Movement")
 	bool CanSprint();
 };
\ No newline at end of file
@@ -7,10 +7,43 @@
 
 ADVANCEDMOVEMENT_API DECLARE_LOG_CATEGORY_EXTERN(LogAdvancedMovement, Log, All);
 
+/** Set by AdvancedMovement.Build.cs if the optional AdvancedLogger plugin is linked. */
+#ifndef ADVANCEDMOVEMENT_WITH_ADVANCED_LOGGER
+#define ADVANCEDMOVEMENT_WITH_ADVANCED_LOGGER 0
+#endif
+
+/** Plugin logging, compiled out of Shipping and Test servers. */
+#ifndef ADVANCEDMOVEMENT_WITH_LOGGING
+#define ADVANCEDMOVEMENT_WITH_LOGGING !(UE_SERVER && (UE_BUILD_SHIPPING || UE_BUILD_TEST))
+#endif
+
+/**
+ * Logs to LogAdvancedMovement through AdvancedLogger if it is present, otherwise through UE_LOG.
+ * Arguments are not evaluated if logging is compiled out, so keep side effects out of them.
+ */
+#if ADVANCEDMOVEMENT_WITH_LOGGING && ADVANCEDMOVEMENT_WITH_ADVANCED_LOGGER
+#include "Subsystems/LoggerLib.h"
+#define ADVANCEDMOVEMENT_LOG_WARNING(Format, ...) TRACEWARN(LogAdvancedMovement, Format, ##__VA_ARGS__)
+#define ADVANCEDMOVEMENT_LOG_ERROR(Format, ...) TRACEERROR(LogAdvancedMovement, Format, ##__VA_ARGS__)
+#elif ADVANCEDMOVEMENT_WITH_LOGGING
+#define ADVANCEDMOVEMENT_LOG_WARNING(Format, ...) UE_LOG(LogAdvancedMovement, Warning, TEXT(Format), ##__VA_ARGS__)
+#define ADVANCEDMOVEMENT_LOG_ERROR(Format, ...) UE_LOG(LogAdvancedMovement, Error, TEXT(Format), ##__VA_ARGS__)
+#else
+#define ADVANCEDMOVEMENT_LOG_WARNING(Format, ...)
+#define ADVANCEDMOVEMENT_LOG_ERROR(Format, ...)
+#endif
+
 class FAdvancedMovementModule : public IModuleInterface
 {
 public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	/** Resets the latency histograms when a CSV capture starts. */
+	FDelegateHandle CsvProfileStartHandle;
+
+	/** Writes the latency histograms when a CSV capture ends. */
+	FDelegateHandle CsvProfileEndHandle;
 };
@@ -5,6 +5,13 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Types/AdvancedMovementBakedCurve.h"
+#include "Types/AdvancedMovementDebugStats.h"
+#include "Types/AdvancedMovementEventStream.h"
+#include "Types/AdvancedMovementFeatures.h"
+#include "Types/AdvancedMovementLatency.h"
+#include "Types/AdvancedMovementNetStats.h"
+#include "Types/AdvancedMovementRootMotion.h"
 #include "AdvancedMovementComponent.generated.h"
 
 /**
@@ -18,6 +25,8 @@ enum ECustomMovementMode
 	CMOVE_MAX UMETA(Hidden) /**< Maximum limit for custom movement modes. */
 };
 
+class AController;
+class UCurveFloat;
 class UAdvancedMovementComponent;
 
 /**
@@ -46,6 +55,91 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FXMC_DashAction, UAdvancedMovementC
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FXMC_ActionMovementMode, UAdvancedMovementComponent*, MovementComponent,
                                                EMovementMode, PrevMode, uint8, PrevCustomMode);
 
+/**
+ * @brief Native counterpart of FXMC_DashAction, broadcast without reflection.
+ * 
+ * @param MovementComponent The movement component that triggered the action.
+ * @param DashDirection The direction of the dash.
+ */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FXMC_DashActionNative, UAdvancedMovementComponent* /*MovementComponent*/,
+                                     uint8 /*DashDirection*/);
+
+/**
+ * @brief Native counterpart of FXMC_ActionMovementMode, broadcast without reflection.
+ * 
+ * @param MovementComponent The movement component that triggered the action.
+ * @param PrevMode The previous movement mode.
+ * @param PrevCustomMode The previous custom movement mode.
+ */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FXMC_ActionMovementModeNative, UAdvancedMovementComponent* /*MovementComponent*/,
+                                       EMovementMode /*PrevMode*/, uint8 /*PrevCustomMode*/);
+
+/**
+ * @brief Immutable copy of the movement state, published once per tick for worker-thread animation updates.
+ */
+USTRUCT(BlueprintType)
+struct ADVANCEDMOVEMENT_API FAdvancedMovementSnapshot
+{
+	GENERATED_BODY()
+
+	/** Movement mode. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	TEnumAsByte<EMovementMode> MovementMode{MOVE_None};
+
+	/** Custom movement mode, see ECustomMovementMode. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	uint8 CustomMovementMode{0};
+
+	/** True if the character is sliding. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	bool bIsSliding{false};
+
+	/** True if the character is sprinting. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	bool bIsSprinting{false};
+
+	/** Direction of the last dash, see UAdvancedMovementComponent::EDashDirection. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	uint8 DashDirection{0};
+
+	/** Seconds since the last dash started. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	float TimeSinceDash{0.f};
+
+	/** Horizontal speed. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	float GroundSpeed{0.f};
+
+	/** Normal of the surface of the current or last slide. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	FVector SlideSurfaceNormal{FVector::UpVector};
+};
+
+/**
+ * @brief Predicted path of a slide or dash, computed without running the movement simulation.
+ */
+USTRUCT(BlueprintType)
+struct ADVANCEDMOVEMENT_API FAdvancedMovementTrajectory
+{
+	GENERATED_BODY()
+
+	/** Sampled locations of the updated component, starting at the current location. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	TArray<FVector> Points;
+
+	/** Predicted end location, moved back to the blocking hit if the endpoint sweep was blocked. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	FVector EndLocation{FVector::ZeroVector};
+
+	/** Predicted duration in seconds. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	float Duration{0.f};
+
+	/** True if the endpoint sweep was requested and hit something. */
+	UPROPERTY(BlueprintReadOnly, Category="Movement")
+	bool bBlocked{false};
+};
+
 /**
  * @class UAdvancedMovementComponent
  * @brief Custom character movement component that adds advanced movement features such as sprinting, sliding, and dashing.
@@ -69,6 +163,43 @@ public:
 		DASH_Max /**< Maximum limit for dash directions. */
 	};
 
+	/**
+	 * @brief Ground traces issued while a saved move was first simulated, reused when the move is replayed.
+	 */
+	struct FGroundQueryRecord
+	{
+		/** Number of traces one move can record. PhysSlide issues at most three. */
+		static constexpr int32 MaxQueries = 4;
+
+		/** Kind of recorded trace. */
+		enum class EQuery : uint8
+		{
+			CanSlide,
+			SlideSurface
+		};
+
+		/** One recorded trace. */
+		struct FEntry
+		{
+			FVector Start{FVector::ZeroVector};
+			FHitResult Hit;
+			EQuery Type{EQuery::CanSlide};
+			bool bHit{false};
+		};
+
+		/** Traces in the order they were issued. */
+		TArray<FEntry, TInlineAllocator<MaxQueries>> Entries;
+
+		/** Entries already consumed by the current replay. */
+		uint8 ReplayUsedMask{0};
+
+		void Reset()
+		{
+			Entries.Reset();
+			ReplayUsedMask = 0;
+		}
+	};
+
 	/**
 	 * @brief Class to save advanced movement states for networking.
 	 */
@@ -105,13 +236,68 @@ public:
          * @brief Indicates if the character previously wanted to crouch.
          */
 		uint8 Saved_bPrevWantsToCrouch : 1;
+
+		/**
+         * @brief Stamina at the start of the move. State, not input: replays continue from the corrected value.
+         */
+		float Saved_Stamina;
+
+		/**
+         * @brief Dash cooldown left at the start of the move, in move time.
+         */
+		float Saved_DashCooldownRemaining;
+
+		/**
+         * @brief Sprint and slide time at the start of the move.
+         */
+		float Saved_SprintTime;
+		float Saved_SlideTime;
+
+		/**
+         * @brief Ground traces issued while this move was recorded.
+         */
+		FGroundQueryRecord GroundQueries;
 		
 		virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+		virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC,
+		                         const FVector& OldStartLocation) override;
 		virtual void Clear() override;
 		virtual uint8 GetCompressedFlags() const override;
 		virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel,
 		                        FNetworkPredictionData_Client_Character& ClientData) override;
 		virtual void PrepMoveFor(ACharacter* C) override;
+		virtual void PostUpdate(ACharacter* C, EPostUpdateMode PostUpdateMode) override;
+	};
+
+	/**
+	 * @brief Move response that also carries predicted advanced movement state, serialized only on corrections.
+	 */
+	struct FAdvancedMoveResponseDataContainer : public FCharacterMoveResponseDataContainer
+	{
+		virtual void ServerFillResponseData(const UCharacterMovementComponent& CharacterMovement,
+		                                    const FClientAdjustment& PendingAdjustment) override;
+		virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar,
+		                       UPackageMap* PackageMap) override;
+
+		/**
+         * @brief Server stamina at the corrected move.
+         */
+		float Stamina{0.f};
+
+		/**
+         * @brief Server dash cooldown left at the corrected move.
+         */
+		float DashCooldownRemaining{0.f};
+
+		/**
+         * @brief Server sprint time at the corrected move.
+         */
+		float SprintTime{0.f};
+
+		/**
+         * @brief Server slide time at the corrected move.
+         */
+		float SlideTime{0.f};
 	};
 
 	/**
@@ -125,8 +311,71 @@ public:
          * @param ClientMovement The character movement component.
          */
 		FNetworkPredictionData_Client_Advanced(const UCharacterMovementComponent& ClientMovement);
+		virtual ~FNetworkPredictionData_Client_Advanced() override;
 		
 		virtual FSavedMovePtr AllocateNewMove() override;
+
+		/**
+		 * @brief Allocates saved moves up front from one contiguous slab and fills the free list with them.
+		 * Does nothing if the slab is already allocated.
+		 * 
+		 * @param NumMoves The number of saved moves to allocate.
+		 */
+		void PrewarmSavedMoves(int32 NumMoves);
+
+		/**
+		 * @brief Gets the memory held by this prediction data, its saved moves and their containers.
+		 * 
+		 * @return The allocated size in bytes.
+		 */
+		SIZE_T GetAllocatedSize() const;
+
+	protected:
+		/**
+		 * @brief Wraps a slab move in a shared pointer that returns it to the slab instead of deleting it.
+		 * 
+		 * @param Move The slab move to wrap.
+		 * @return The shared pointer to the move.
+		 */
+		FSavedMovePtr MakeSlabMove(FSavedMove_Advanced* Move);
+
+		/**
+		 * @brief Contiguous storage for prewarmed saved moves. Never resized once allocated.
+		 */
+		TArray<FSavedMove_Advanced> SavedMoveSlab;
+
+		/**
+		 * @brief Slab moves not referenced by any shared pointer.
+		 */
+		TArray<FSavedMove_Advanced*> FreeSlabMoves;
+	};
+
+	/**
+	 * @brief Descriptor of a custom movement mode. Registered in RegisterCustomModes and resolved once per mode change.
+	 *
+	 * Subclasses can bind their own functions with static_cast, e.g.
+	 * static_cast<FCustomModeDescriptor::FPhysFunction>(&UMyMovementComponent::PhysProne).
+	 */
+	struct FCustomModeDescriptor
+	{
+		using FPhysFunction = void (UAdvancedMovementComponent::*)(float, int32);
+		using FEnterFunction = void (UAdvancedMovementComponent::*)(EMovementMode, ECustomMovementMode);
+		using FExitFunction = void (UAdvancedMovementComponent::*)();
+
+		/** Called from PhysCustom while the mode is active. */
+		FPhysFunction Phys{nullptr};
+
+		/** Called when the mode is entered. Optional. */
+		FEnterFunction Enter{nullptr};
+
+		/** Called when the mode is left. Optional. */
+		FExitFunction Exit{nullptr};
+
+		/** Value returned by GetMaxSpeed while the mode is active. */
+		float MaxSpeed{0.f};
+
+		/** Value returned by GetMaxBrakingDeceleration while the mode is active. */
+		float MaxBrakingDeceleration{0.f};
 	};
 
 public:
@@ -154,15 +403,55 @@ protected:
 	bool Safe_bWantsToDash{false};
 
 	/** 
-	 * @brief Timer handle for the dash cooldown.
+	 * @brief Current stamina, simulated identically on client and server from the move stream.
 	 */
-	FTimerHandle TimerHandle_DashCooldown;
+	float Safe_Stamina{0.f};
+
+	/** 
+	 * @brief Dash cooldown left, counted down by the delta time of each move so client and server agree exactly.
+	 */
+	float Safe_DashCooldownRemaining{0.f};
+
+	/** 
+	 * @brief Time spent sprinting on the ground, in move time. Drives Sprint_RampCurve.
+	 */
+	float Safe_SprintTime{0.f};
+
+	/** 
+	 * @brief Time spent in the current slide, in move time. Drives Slide_DecayCurve.
+	 */
+	float Safe_SlideTime{0.f};
+
+	/** 
+	 * @brief Move response container that carries Safe_Stamina and Safe_DashCooldownRemaining on corrections.
+	 */
+	FAdvancedMoveResponseDataContainer AdvancedMoveResponseData;
 
 	/** 
 	 * @brief The start time of the dash.
 	 */
 	float DashStartTime;
 
+	/** 
+	 * @brief Direction of the last dash, local or replicated.
+	 */
+	uint8 LastDashDirection{DASH_None};
+
+	/** 
+	 * @brief Normal of the last slide surface.
+	 */
+	FVector LastSlideSurfaceNormal{FVector::UpVector};
+
+	/** 
+	 * @brief State published at the end of the last tick.
+	 */
+	FAdvancedMovementSnapshot PublishedSnapshot;
+
+	/** 
+	 * @brief Guards PublishedSnapshot against worker-thread readers.
+	 */
+	mutable FRWLock SnapshotLock;
+
 	/** 
 	 * @brief The owning character of this movement component.
 	 */
@@ -175,6 +464,164 @@ protected:
 	UPROPERTY(ReplicatedUsing=OnRep_DashStart)
 	bool Proxy_bDashStart;
 
+	/** 
+	 * @brief The controller whose tick the batched tick currently waits for.
+	 */
+	TWeakObjectPtr<AController> BatchedTickController;
+
+	/** 
+	 * @brief The movement event stream of the world, null if the stream is disabled.
+	 */
+	TSharedPtr<FAdvancedMovementEventStream, ESPMode::ThreadSafe> EventStream;
+
+	/** 
+	 * @brief The async physics subsystem, set only if bUseAsyncPhysics is enabled.
+	 */
+	UPROPERTY(Transient)
+	class UAdvancedMovementAsyncSubsystem* AsyncPhysics;
+
+	/** 
+	 * @brief Incremented on every slide entry, so async results of an earlier slide are recognized.
+	 */
+	uint32 AsyncSlideSerial{0};
+
+	/** 
+	 * @brief LocalID of the active root motion dash, 0 if none.
+	 */
+	uint16 DashRootMotionSourceID{0};
+
+	/** 
+	 * @brief Component of the slide surface the active slide parameters were resolved for.
+	 */
+	TWeakObjectPtr<UPrimitiveComponent> SlideSurfaceComponent;
+
+	/** 
+	 * @brief Physical material of the slide surface the active slide parameters were resolved for.
+	 */
+	TWeakObjectPtr<UPhysicalMaterial> SlideSurfaceMaterial;
+
+	/** 
+	 * @brief Slide friction of the current surface.
+	 */
+	float ActiveSlideFriction{0.f};
+
+	/** 
+	 * @brief Slide gravity force of the current surface.
+	 */
+	float ActiveSlideGravityForce{0.f};
+
+	/** 
+	 * @brief Sprint_RampCurve baked by RefreshCustomModes.
+	 */
+	FAdvancedMovementBakedCurve SprintRampTable;
+
+	/** 
+	 * @brief Slide_DecayCurve baked by RefreshCustomModes.
+	 */
+	FAdvancedMovementBakedCurve SlideDecayTable;
+
+	/** 
+	 * @brief Location of the last blocked uncrouch at the end of a slide.
+	 */
+	FVector SlideUnCrouchBlockedLocation{FVector::ZeroVector};
+
+	/** 
+	 * @brief Move time since the last blocked uncrouch at the end of a slide.
+	 */
+	float SlideUnCrouchBlockedTime{0.f};
+
+	/** 
+	 * @brief True if the capsule still has to grow back after a slide.
+	 */
+	bool bSlideUnCrouchPending{false};
+
+	/** 
+	 * @brief True if the last uncrouch test at SlideUnCrouchBlockedLocation was blocked.
+	 */
+	bool bSlideUnCrouchBlocked{false};
+
+	/** 
+	 * @brief Cost and network counters, only recorded if ADVANCEDMOVEMENT_WITH_DEBUG_STATS is set.
+	 */
+	mutable FAdvancedMovementDebugStats DebugStats;
+
+	/** 
+	 * @brief Saved move and ServerMove counters, only recorded if ADVANCEDMOVEMENT_WITH_NET_STATS is set.
+	 */
+	mutable FAdvancedMovementNetStats NetStats;
+
+	/** 
+	 * @brief Latency clock value of each input press still waiting for its effect, negative if none.
+	 */
+	mutable double LatencyPressTimes[static_cast<uint8>(EAdvancedMovementInput::MAX)]{-1.0, -1.0, -1.0};
+
+	/** 
+	 * @brief The significance governor, set only on the server if bUseSignificanceGovernor is enabled.
+	 */
+	UPROPERTY(Transient)
+	class UAdvancedMovementSignificanceSubsystem* Significance;
+
+	/** 
+	 * @brief Current significance tier, 0 being full cost.
+	 */
+	uint8 SignificanceTier{0};
+
+	/** 
+	 * @brief Last CanSlide surface result, reused when the ground probe budget is exhausted.
+	 */
+	mutable bool bLastCanSlideSurface{false};
+
+	/** 
+	 * @brief Location bLastCanSlideSurface was probed at.
+	 */
+	mutable FVector LastCanSlideSurfaceLocation{FVector::ZeroVector};
+
+	/** 
+	 * @brief Last slide surface result, reused when the ground probe budget is exhausted.
+	 */
+	mutable bool bLastSlideSurfaceHit{false};
+
+	/** 
+	 * @brief Last slide surface hit, reused when the ground probe budget is exhausted.
+	 */
+	mutable FHitResult LastSlideSurfaceHit;
+
+	/** 
+	 * @brief Location LastSlideSurfaceHit was probed at.
+	 */
+	mutable FVector LastSlideSurfaceLocation{FVector::ZeroVector};
+
+	/** 
+	 * @brief Registered custom modes, indexed by custom movement mode.
+	 */
+	TArray<FCustomModeDescriptor> CustomModes;
+
+	/** 
+	 * @brief Saved move the ground traces of the current move are recorded into, client only.
+	 */
+	FGroundQueryRecord* GroundQueryRecording{nullptr};
+
+	/** 
+	 * @brief Saved move whose recorded ground traces may be reused, set while replaying it.
+	 */
+	FGroundQueryRecord* GroundQueryReplay{nullptr};
+
+	/** 
+	 * @brief Index of the current custom mode in CustomModes, INDEX_NONE if not in a registered custom mode.
+	 * An index rather than a pointer, since registering a mode may reallocate CustomModes.
+	 */
+	int32 ActiveCustomModeIndex{INDEX_NONE};
+
+	/** 
+	 * @brief GetMaxSpeed of the current custom mode, cached on mode change.
+	 */
+	float CachedCustomMaxSpeed{0.f};
+
+	/** 
+	 * @brief GetMaxBrakingDeceleration of the current custom mode, cached on mode change.
+	 */
+	float CachedCustomMaxBrakingDeceleration{0.f};
+
 protected:
 	/** 
      * @brief The maximum sprint speed.
@@ -182,6 +629,13 @@ protected:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Walk")
 	float Sprint_MaxSpeed{550.0f};
 
+	/** 
+     * @brief Optional sprint ramp-up. Maps seconds of sprinting to a blend from MaxWalkSpeed (0) to
+     * Sprint_MaxSpeed (1). Baked into a lookup table, changes apply on RefreshCustomModes.
+     */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Walk")
+	TObjectPtr<UCurveFloat> Sprint_RampCurve;
+
 	// /** 
 	//  * @brief The maximum walk speed.
 	//  */
@@ -195,13 +649,15 @@ protected:
 	float Slide_MinSpeed{200.0f};
 
 	/** 
-	 * @brief The maximum speed during a slide.
+	 * @brief The maximum speed during a slide. Copied into the slide mode descriptor, runtime changes apply on
+	 * RefreshCustomModes.
 	 */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide")
 	float Slide_MaxSpeed{600.0f};
 
 	/** 
-	 * @brief The maximum braking deceleration during a slide.
+	 * @brief The maximum braking deceleration during a slide. Copied into the slide mode descriptor, runtime
+	 * changes apply on RefreshCustomModes.
 	 */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide")
 	float Slide_MaxBrakingDeceleration{2048.0f};
@@ -224,12 +680,39 @@ protected:
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide")
 	float Slide_Friction{1.3f};
 
+	/** 
+	 * @brief Optional slide speed decay. Maps seconds of sliding to a multiplier of the slide friction.
+	 * Baked into a lookup table, changes apply on RefreshCustomModes.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide")
+	TObjectPtr<UCurveFloat> Slide_DecayCurve;
+
 	/** 
 	 * @brief Flag indicating if velocity should be reset when starting a slide.
 	 */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide")
 	bool Slide_ResetVelocity{false};
 
+	/** 
+	 * @brief Optional per physical material scaling of Slide_Friction and Slide_GravityForce.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide")
+	TObjectPtr<class UAdvancedSlideSurfaceTable> Slide_SurfaceTable;
+
+	/** 
+	 * @brief Distance the character must move after a blocked uncrouch at the end of a slide before the
+	 * standing clearance is tested again.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide", meta=(ClampMin="0", Units="cm"))
+	float Slide_UnCrouchRetestDistance{5.0f};
+
+	/** 
+	 * @brief Time after a blocked uncrouch at the end of a slide before the standing clearance is tested again,
+	 * even if the character did not move, e.g. when the blocking geometry moved away.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Slide", meta=(ClampMin="0", Units="s"))
+	float Slide_UnCrouchRetestInterval{0.25f};
+
 	/** 
 	 * @brief Dash impulse when moving forward.
 	 */
@@ -255,25 +738,230 @@ protected:
 	float Dash_Impulse_L{100.0f};
 
 	/** 
-	 * @brief Cooldown duration for dashing.
+	 * @brief Cooldown duration for dashing, in move time. Enforced identically by client and server.
 	 */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Dash")
 	float Dash_CooldownDuration{1.f};
 
 	/** 
-	 * @brief Cooldown duration for dashing, as authorized by the server.
+	 * @brief No longer used, the server enforces Dash_CooldownDuration exactly.
+	 */
+	UPROPERTY(meta=(DeprecatedProperty, DeprecationMessage="The server enforces Dash_CooldownDuration exactly."))
+	float Dash_AuthCooldownDuration_DEPRECATED{.9f};
+
+	/** 
+	 * @brief If true, the dash is a predicted root motion source shaped by Dash_RootMotion_* instead of a velocity
+	 * impulse followed by falling. The Dash_Impulse_* values become the dash speed.
 	 */
 	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Dash")
-	float Dash_AuthCooldownDuration{.9f};
+	bool Dash_bUseRootMotionSource{false};
+
+	/** 
+	 * @brief Root motion dash shape when moving forward.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, DisplayName="Dash Root Motion (Forward)",
+		Category="Movement|Dash", meta=(EditCondition="Dash_bUseRootMotionSource"))
+	FAdvancedDashRootMotionParams Dash_RootMotion_F;
+
+	/** 
+	 * @brief Root motion dash shape when moving backward.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, DisplayName="Dash Root Motion (Backward)",
+		Category="Movement|Dash", meta=(EditCondition="Dash_bUseRootMotionSource"))
+	FAdvancedDashRootMotionParams Dash_RootMotion_B;
+
+	/** 
+	 * @brief Root motion dash shape when moving to the right.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, DisplayName="Dash Root Motion (Right)",
+		Category="Movement|Dash", meta=(EditCondition="Dash_bUseRootMotionSource"))
+	FAdvancedDashRootMotionParams Dash_RootMotion_R;
+
+	/** 
+	 * @brief Root motion dash shape when moving to the left.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, DisplayName="Dash Root Motion (Left)",
+		Category="Movement|Dash", meta=(EditCondition="Dash_bUseRootMotionSource"))
+	FAdvancedDashRootMotionParams Dash_RootMotion_L;
+
+	/** 
+	 * @brief Speed the character is clamped to when a root motion dash ends.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Dash",
+		meta=(ClampMin="0", EditCondition="Dash_bUseRootMotionSource"))
+	float Dash_RootMotionExitSpeed{600.f};
+
+	/** 
+	 * @brief If true, sprinting and sliding drain stamina and dashes cost stamina.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Stamina")
+	bool bUseStamina{false};
+
+	/** 
+	 * @brief The maximum stamina.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Stamina", meta=(EditCondition="bUseStamina"))
+	float Stamina_Max{100.f};
+
+	/** 
+	 * @brief Stamina drained per second while sprinting.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Stamina", meta=(EditCondition="bUseStamina"))
+	float Stamina_SprintDrainRate{10.f};
+
+	/** 
+	 * @brief Stamina drained per second while sliding.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Stamina", meta=(EditCondition="bUseStamina"))
+	float Stamina_SlideDrainRate{15.f};
+
+	/** 
+	 * @brief Stamina spent by a dash.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Stamina", meta=(EditCondition="bUseStamina"))
+	float Stamina_DashCost{25.f};
+
+	/** 
+	 * @brief Stamina regenerated per second while neither sprinting nor sliding.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Stamina", meta=(EditCondition="bUseStamina"))
+	float Stamina_RegenRate{20.f};
+
+	/** 
+	 * @brief If true, the component is ticked by UAdvancedMovementTickSubsystem instead of its own tick function.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Tick")
+	bool bUseBatchedTick{false};
+
+	/** 
+	 * @brief If true, the owning actor tick is disabled while batched, unless the actor implements Blueprint Tick.
+	 * Disable it for C++ subclasses that override Tick.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Tick", meta=(EditCondition="bUseBatchedTick"))
+	bool bBatchedTickDisablesActorTick{true};
+
+	/** 
+	 * @brief Number of saved moves allocated up front when the autonomous proxy is possessed.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Network", meta=(ClampMin="0"))
+	int32 Net_PrewarmedSavedMoves{32};
+
+	/** 
+	 * @brief If true, the server records this character in UAdvancedMovementHistorySubsystem for lag compensation.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Network")
+	bool bRecordLagCompensationHistory{false};
+
+	/** 
+	 * @brief Maximum distance between a replayed and a recorded trace start for the recorded result to be reused.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Network", meta=(ClampMin="0"))
+	float Net_ReplayQueryTolerance{1.f};
+
+	/** 
+	 * @brief If true, slide velocity integration runs in a Chaos async physics callback at the physics rate. Only applies to characters without a predicting client (AI, listen server host, standalone),
+	 * since the physics thread results are not reproduced by client prediction.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Physics")
+	bool bUseAsyncPhysics{false};
+
+	/** 
+	 * @brief If true, dedicated servers may throttle this character by distance to players while it is not
+	 * player-controlled. Requires UAdvancedMovementSettings::bEnableSignificanceGovernor.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement|Significance")
+	bool bUseSignificanceGovernor{true};
+
+	/** 
+	 * @brief Smallest rotation change written by slides and dashes. Smaller changes keep the current rotation,
+	 * so attached components are not moved for it.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category="Movement", meta=(ClampMin="0", Units="Degrees"))
+	float MinRotationUpdateAngle{0.5f};
 
 protected:
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void InitializeComponent() override;
 	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
 	virtual void OnMovementUpdated(float DeltaSeconds, const FVector& OldLocation, const FVector& OldVelocity) override;
 	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
 	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+	virtual void PerformMovement(float DeltaTime) override;
+	virtual void ReplicateMoveToServer(float DeltaTime, const FVector& NewAcceleration) override;
+	virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
+	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+	virtual void CallServerMovePacked(const FSavedMove_Character* NewMove, const FSavedMove_Character* PendingMove,
+	                                  const FSavedMove_Character* OldMove) override;
+	virtual void ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits) override;
+	virtual bool VerifyClientTimeStamp(float TimeStamp, FNetworkPredictionData_Server_Character& ServerData) override;
+
+	/**
+	 * @brief Registers the custom movement modes of this component. Override to add modes, call Super to keep Slide.
+	 */
+	virtual void RegisterCustomModes();
+
+	/**
+	 * @brief Adds or replaces a custom movement mode. Re-caches the mode constants if it is the current mode.
+	 * 
+	 * @param InCustomMode The custom movement mode value.
+	 * @param InDescriptor The mode functions and constants.
+	 */
+	void RegisterCustomMode(uint8 InCustomMode, const FCustomModeDescriptor& InDescriptor);
+
+	/**
+	 * @brief Finds the descriptor of a custom movement mode.
+	 * 
+	 * @param InCustomMode The custom movement mode value.
+	 * @return The descriptor, or null if the mode is not registered.
+	 */
+	const FCustomModeDescriptor* FindCustomMode(uint8 InCustomMode) const;
+
+	/**
+	 * @brief Gets the descriptor of the current custom mode.
+	 * 
+	 * @return The descriptor, or null if not in a registered custom mode.
+	 */
+	const FCustomModeDescriptor* GetActiveCustomMode() const
+	{
+		return CustomModes.IsValidIndex(ActiveCustomModeIndex) ? &CustomModes[ActiveCustomModeIndex] : nullptr;
+	}
+
+	/**
+	 * @brief Resolves the active descriptor and caches its constants for the hot getters.
+	 */
+	void CacheActiveCustomMode();
+
+	/**
+	 * @brief Drains or regenerates stamina for one simulated move.
+	 * 
+	 * @param DeltaSeconds The move delta time.
+	 */
+	virtual void UpdateStamina(float DeltaSeconds);
+
+	/**
+	 * @brief Checks if a move response corrected the client, rather than being dropped for an unknown move.
+	 * Valid after Super::ClientHandleMoveResponse processed it.
+	 * 
+	 * @param MoveResponse The move response.
+	 * @return True if the correction was applied, otherwise false.
+	 */
+	bool WasCorrectionApplied(const FCharacterMoveResponseDataContainer& MoveResponse) const;
+
+	/**
+	 * @brief Advances or resets the sprint and slide times for one simulated move.
+	 * 
+	 * @param DeltaSeconds The move delta time.
+	 */
+	void UpdateRampTimes(float DeltaSeconds);
+
+	/**
+	 * @brief Gets the slide friction of the current surface and slide time.
+	 * 
+	 * @return The slide friction.
+	 */
+	float GetSlideFriction() const;
 
 	/**
 	 * @brief Checks if sprinting is allowed.
@@ -319,6 +1007,54 @@ protected:
 	 */
 	virtual bool GetSlideSurface(FHitResult& Hit) const;
 
+	/**
+	 * @brief Resolves the slide parameters of a surface, only if its component or physical material changed.
+	 * 
+	 * @param InSurfaceHit The slide surface hit.
+	 */
+	void UpdateSlideSurfaceParams(const FHitResult& InSurfaceHit);
+
+	/**
+	 * @brief Looks up a trace recorded by the saved move being replayed.
+	 * 
+	 * @param InType The kind of trace.
+	 * @param InStart The start of the trace about to be issued.
+	 * @param OutHit The recorded hit, if requested.
+	 * @param bOutHit The recorded trace result.
+	 * @return True if a recorded trace within Net_ReplayQueryTolerance was found, otherwise false.
+	 */
+	bool FindReplayedGroundQuery(FGroundQueryRecord::EQuery InType, const FVector& InStart, FHitResult* OutHit,
+	                             bool& bOutHit) const;
+
+	/**
+	 * @brief Records a trace into the saved move being created, if any.
+	 * 
+	 * @param InType The kind of trace.
+	 * @param InStart The start of the trace.
+	 * @param InHit The hit, if any.
+	 * @param bInHit The trace result.
+	 */
+	void RecordGroundQuery(FGroundQueryRecord::EQuery InType, const FVector& InStart, const FHitResult* InHit,
+	                       bool bInHit) const;
+
+	/**
+	 * @brief Checks if this character is throttled and still close enough to reuse a ground probe result.
+	 * 
+	 * @param InLocation The location of the new probe.
+	 * @param InProbeLocation The location the last result was probed at.
+	 * @return True if the last result may be reused.
+	 */
+	bool CanReuseGroundProbe(const FVector& InLocation, const FVector& InProbeLocation) const;
+
+	/**
+	 * @brief Takes a ground probe from the shared budget if the last result could be reused.
+	 * 
+	 * @param InLocation The location of the new probe.
+	 * @param InProbeLocation The location the last result was probed at.
+	 * @return True if the trace may be issued, false if the last result must be reused.
+	 */
+	bool ConsumeGroundProbe(const FVector& InLocation, const FVector& InProbeLocation) const;
+
 	/**
 	 * @brief Checks if the character can dash.
 	 * 
@@ -332,9 +1068,20 @@ protected:
 	virtual void PerformDash();
 
 	/**
-	 * @brief Called when the dash cooldown finishes.
+	 * @brief Applies the dash as a root motion source.
+	 * 
+	 * @param InDirection Normalized world direction of the dash.
+	 * @param InDashSide The dash direction relative to the character.
+	 * @param InSpeed The dash speed.
+	 */
+	void ApplyDashRootMotion(const FVector& InDirection, EDashDirection InDashSide, float InSpeed);
+
+	/**
+	 * @brief Checks if the slide velocity of this character is integrated on the physics thread.
+	 * 
+	 * @return True if the async physics mode applies, otherwise false.
 	 */
-	virtual void OnDashCooldownFinished();
+	bool ShouldUseAsyncPhysics() const;
 
 	/**
 	 * @brief Calculates the dash direction based on the input angle.
@@ -351,15 +1098,121 @@ protected:
 	 */
 	virtual float CalculateDirection() const;
 
+	/**
+	 * @brief Gets the dash impulse of a dash direction.
+	 * 
+	 * @param InDashSide The dash direction.
+	 * @return The impulse, or the dash speed in root motion mode.
+	 */
+	float GetDashImpulse(EDashDirection InDashSide) const;
+
+	/**
+	 * @brief Gets the root motion dash shape of a dash direction.
+	 * 
+	 * @param InDashSide The dash direction.
+	 * @return The dash shape.
+	 */
+	const FAdvancedDashRootMotionParams& GetDashRootMotionParams(EDashDirection InDashSide) const;
+
+	/**
+	 * @brief Sweeps the capsule from the start to the end of a predicted trajectory and clips it at the first hit.
+	 * 
+	 * @param InOutTrajectory The trajectory to validate.
+	 */
+	void SweepTrajectoryEndpoint(FAdvancedMovementTrajectory& InOutTrajectory) const;
+
+	/**
+	 * @brief Drops rotation changes below MinRotationUpdateAngle.
+	 * 
+	 * @param InNewRotation The desired rotation.
+	 * @return The desired rotation, or the current rotation if the change is too small.
+	 */
+	FQuat FilterRotationUpdate(const FQuat& InNewRotation) const;
+
 	/**
 	 * @brief Called when the dash start is replicated.
 	 */
 	UFUNCTION()
 	virtual void OnRep_DashStart();
 
+	/**
+	 * @brief Copies the current state into PublishedSnapshot. Called at the end of every tick.
+	 */
+	void PublishSnapshot();
+
+	/**
+	 * @brief Fires OnEnteredSlideNative and, if bound, OnEnteredSlide.
+	 * 
+	 * @param PrevMode The previous movement mode.
+	 * @param PrevCustomMode The previous custom movement mode.
+	 */
+	void BroadcastEnteredSlide(EMovementMode PrevMode, uint8 PrevCustomMode);
+
+	/**
+	 * @brief Fires OnLeftSlideNative and, if bound, OnLeftSlide.
+	 * 
+	 * @param PrevMode The previous movement mode.
+	 * @param PrevCustomMode The previous custom movement mode.
+	 */
+	void BroadcastLeftSlide(EMovementMode PrevMode, uint8 PrevCustomMode);
+
+	/**
+	 * @brief Fires OnDashStartedNative and, if bound, OnDashStarted.
+	 * 
+	 * @param DashDirection The direction of the dash.
+	 */
+	void BroadcastDashStarted(uint8 DashDirection);
+
+	/**
+	 * @brief Publishes an event to the world movement event stream, if it is enabled. Skipped while replaying moves.
+	 * 
+	 * @param InType The kind of event.
+	 * @param InPayload Type-specific data.
+	 */
+	void PushMovementEvent(EAdvancedMovementEventType InType, uint8 InPayload = 0) const;
+
+	/**
+	 * @brief Gets the debug stats, rolled over to the current frame.
+	 * 
+	 * @return The debug stats.
+	 */
+	FAdvancedMovementDebugStats& GetFrameDebugStats() const;
+
+	/**
+	 * @brief Gets the clock input latency is measured with. Seconds of client move time on a server simulating a
+	 * remote client, platform seconds everywhere else.
+	 * 
+	 * @param bOutServer True if the clock is the client move time.
+	 * @return The clock value.
+	 */
+	double GetLatencyClock(bool& bOutServer) const;
+
+	/**
+	 * @brief Starts measuring the latency of an input, unless a press is already waiting for its effect.
+	 * 
+	 * @param InInput The pressed input.
+	 */
+	void MarkInputPressed(EAdvancedMovementInput InInput) const;
+
+	/**
+	 * @brief Stops measuring the latency of an input released before its effect.
+	 * 
+	 * @param InInput The released input.
+	 */
+	void MarkInputReleased(EAdvancedMovementInput InInput) const;
+
+	/**
+	 * @brief Records the latency of an input whose effect was simulated. Ignored while replaying saved moves.
+	 * 
+	 * @param InInput The input.
+	 */
+	void MarkInputEffect(EAdvancedMovementInput InInput) const;
+
 public:
 	virtual bool IsMovingOnGround() const override;
 	virtual bool CanCrouchInCurrentState() const override;
+	virtual void Crouch(bool bClientSimulation = false) override;
+	virtual void UnCrouch(bool bClientSimulation = false) override;
 	virtual float GetMaxSpeed() const override;
 	virtual float GetMaxBrakingDeceleration() const override;
 	
@@ -368,6 +1221,43 @@ public:
 	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
 	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/**
+	 * @brief Checks if the component is ticked by UAdvancedMovementTickSubsystem.
+	 * 
+	 * @return True if the component is batched, otherwise false.
+	 */
+	bool IsUsingBatchedTick() const { return bUseBatchedTick; }
+
+	/**
+	 * @brief Called by the owning character when its controller changes, keeps the batch tick ordered after it.
+	 */
+	virtual void HandleControllerChanged();
+
+	/**
+	 * @brief Creates the client prediction data and its saved move pool ahead of the first move.
+	 * Only does work on autonomous proxies.
+	 */
+	virtual void PrewarmPredictionData();
+
+	/**
+	 * @brief Re-registers the custom modes, e.g. after changing slide constants at runtime.
+	 */
+	void RefreshCustomModes();
+
+	/**
+	 * @brief Sets the significance tier, called by UAdvancedMovementSignificanceSubsystem.
+	 * 
+	 * @param InTier The tier, 0 being full cost.
+	 */
+	void SetSignificanceTier(uint8 InTier);
+
+	/**
+	 * @brief Gets the significance tier.
+	 * 
+	 * @return The tier, 0 being full cost.
+	 */
+	uint8 GetSignificanceTier() const { return SignificanceTier; }
 	
 	/**
 	* @brief Checks if the character is sliding.
@@ -419,6 +1309,11 @@ public:
     UFUNCTION(BlueprintCallable)
     virtual void DashPressed();
 
+	/**
+	* @brief Checks if the dash cooldown is over.
+	* 
+	* @return True if the cooldown is over, otherwise false.
+	*/
 	UFUNCTION(BlueprintCallable)
 	bool IsAbleToDash() const;
     /**
@@ -427,6 +1322,91 @@ public:
     UFUNCTION(BlueprintCallable)
     virtual void DashReleased();
 
+    /**
+    * @brief Gets the state published at the end of the last tick. Safe to call from animation worker threads.
+    * 
+    * @return A copy of the snapshot.
+    */
+    UFUNCTION(BlueprintCallable, BlueprintPure, meta=(BlueprintThreadSafe))
+    FAdvancedMovementSnapshot GetMovementSnapshot() const;
+
+    /**
+    * @brief Predicts the slide that would follow from the current velocity with no input, stepping the slide
+    * gravity and friction on the current surface plane. Includes the enter impulse if not sliding yet.
+    * 
+    * @param MaxTime Longest slide to predict, in seconds.
+    * @param TimeStep Integration step, in seconds.
+    * @param bSweepEndpoint If true, one capsule sweep from the start to the end validates the result.
+    * @return The predicted trajectory.
+    */
+    UFUNCTION(BlueprintCallable, Category="Movement|Prediction")
+    FAdvancedMovementTrajectory PredictSlideTrajectory(float MaxTime = 3.f, float TimeStep = .1f,
+                                                       bool bSweepEndpoint = false) const;
+
+    /**
+    * @brief Predicts the dash that would be performed now towards a direction, in closed form.
+    * 
+    * @param InDirection World direction of the dash, the character forward if zero.
+    * @param NumPoints Number of sampled points.
+    * @param bSweepEndpoint If true, one capsule sweep from the start to the end validates the result.
+    * @return The predicted trajectory.
+    */
+    UFUNCTION(BlueprintCallable, Category="Movement|Prediction")
+    FAdvancedMovementTrajectory PredictDashTrajectory(FVector InDirection, int32 NumPoints = 8,
+                                                      bool bSweepEndpoint = false) const;
+
+    /**
+    * @brief Gets the current stamina.
+    * 
+    * @return The current stamina.
+    */
+    UFUNCTION(BlueprintCallable, BlueprintPure)
+    float GetStamina() const { return Safe_Stamina; }
+
+    /**
+    * @brief Gets the maximum stamina.
+    * 
+    * @return The maximum stamina.
+    */
+    UFUNCTION(BlueprintCallable, BlueprintPure)
+    float GetStaminaMax() const { return Stamina_Max; }
+
+    /**
+    * @brief Gets the seconds left until the dash can be used again.
+    * 
+    * @return The remaining cooldown, 0 if the dash is ready.
+    */
+    UFUNCTION(BlueprintCallable, BlueprintPure)
+    float GetDashCooldownRemaining() const;
+
+    /**
+    * @brief Gets the number of saved moves not acknowledged by the server yet. Autonomous proxies only.
+    * 
+    * @return The number of pending saved moves.
+    */
+    int32 GetNumPendingSavedMoves() const;
+
+    /**
+    * @brief Gets the memory held by the client and server prediction data, used by am.MemReport.
+    * 
+    * @return The allocated size in bytes.
+    */
+    SIZE_T GetPredictionDataAllocatedSize() const;
+
+    /**
+    * @brief Gets the cost and network counters, recorded only if ADVANCEDMOVEMENT_WITH_DEBUG_STATS is set.
+    * 
+    * @return The debug stats.
+    */
+    const FAdvancedMovementDebugStats& GetDebugStats() const { return GetFrameDebugStats(); }
+
+    /**
+    * @brief Gets the saved move and ServerMove counters, recorded only if ADVANCEDMOVEMENT_WITH_NET_STATS is set.
+    * 
+    * @return The net stats.
+    */
+    const FAdvancedMovementNetStats& GetNetStats() const { return NetStats; }
+
     /**
     * @brief Checks if the character is sprinting.
     * 
@@ -476,4 +1456,19 @@ public:
     */
     UPROPERTY(BlueprintReadOnly, BlueprintAssignable, DisplayName="On dashed")
     FXMC_DashAction OnDashStarted;
+
+    /** 
+    * @brief Native event triggered when the character starts sliding. Fired before OnEnteredSlide.
+    */
+    FXMC_ActionMovementModeNative OnEnteredSlideNative;
+
+    /** 
+    * @brief Native event triggered when the character finishes sliding. Fired before OnLeftSlide.
+    */
+    FXMC_ActionMovementModeNative OnLeftSlideNative;
+
+    /** 
+    * @brief Native event triggered when the character starts dashing. Fired before OnDashStarted.
+    */
+    FXMC_DashActionNative OnDashStartedNative;
 };
@@ -0,0 +1,61 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AdvancedSlideSurfaceTable.generated.h"
+
+class UPhysicalMaterial;
+
+/**
+ * @brief Slide tuning of one physical material, relative to the component's Slide_* values.
+ */
+USTRUCT(BlueprintType)
+struct ADVANCEDMOVEMENT_API FAdvancedSlideSurfaceParams
+{
+	GENERATED_BODY()
+
+	/** 
+	 * @brief Multiplier of Slide_Friction.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, meta=(ClampMin="0"))
+	float FrictionMultiplier{1.f};
+
+	/** 
+	 * @brief Multiplier of Slide_GravityForce.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, meta=(ClampMin="0"))
+	float GravityForceMultiplier{1.f};
+};
+
+/**
+ * @class UAdvancedSlideSurfaceTable
+ * @brief Per physical material slide tuning. Materials missing from the table use the default parameters.
+ */
+UCLASS(BlueprintType)
+class ADVANCEDMOVEMENT_API UAdvancedSlideSurfaceTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * @brief Finds the slide parameters of a physical material.
+	 * 
+	 * @param InMaterial The physical material of the slide surface, may be null.
+	 * @return The parameters of the material, or DefaultParams if it has no entry.
+	 */
+	const FAdvancedSlideSurfaceParams& FindParams(const UPhysicalMaterial* InMaterial) const;
+
+	/** 
+	 * @brief Parameters of surfaces without a physical material or without an entry.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category="Slide")
+	FAdvancedSlideSurfaceParams DefaultParams;
+
+	/** 
+	 * @brief Parameters by physical material.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category="Slide")
+	TMap<TObjectPtr<UPhysicalMaterial>, FAdvancedSlideSurfaceParams> Surfaces;
+};
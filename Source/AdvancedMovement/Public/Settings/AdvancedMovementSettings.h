@@ -0,0 +1,96 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "AdvancedMovementSettings.generated.h"
+
+/**
+ * @class UAdvancedMovementSettings
+ * @brief Project-wide settings of the AdvancedMovement plugin. Per-character tuning stays on UAdvancedMovementComponent.
+ */
+UCLASS(Config=Game, DefaultConfig, meta=(DisplayName="Advanced Movement"))
+class ADVANCEDMOVEMENT_API UAdvancedMovementSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UAdvancedMovementSettings();
+
+	/**
+	 * @brief Gets the settings object.
+	 * 
+	 * @return The class default object of the settings.
+	 */
+	static const UAdvancedMovementSettings* Get() { return GetDefault<UAdvancedMovementSettings>(); }
+
+	/** 
+	 * @brief If true, every game world gets a movement event stream that worker threads can drain.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Events")
+	bool bEnableEventStream{false};
+
+	/** 
+	 * @brief Number of events the stream holds before new events are dropped. Rounded up to a power of two.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Events",
+		meta=(ClampMin="64", EditCondition="bEnableEventStream"))
+	int32 EventStreamCapacity{4096};
+
+	/** 
+	 * @brief Number of server frames kept by the lag compensation history.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Lag Compensation", meta=(ClampMin="2"))
+	int32 LagCompensationHistoryFrames{64};
+
+	/** 
+	 * @brief If true, dedicated servers throttle movement of AI characters far from every player.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Significance")
+	bool bEnableSignificanceGovernor{false};
+
+	/** 
+	 * @brief Seconds between two significance tier updates.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Significance",
+		meta=(ClampMin="0", Units="s", EditCondition="bEnableSignificanceGovernor"))
+	float SignificanceUpdateInterval{0.25f};
+
+	/** 
+	 * @brief Ascending distances to the nearest player at which a character drops to the next tier.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Significance",
+		meta=(EditCondition="bEnableSignificanceGovernor"))
+	TArray<float> SignificanceTierDistances;
+
+	/** 
+	 * @brief Movement tick interval of each tier. Tiers past the end of the array use the last entry.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Significance",
+		meta=(EditCondition="bEnableSignificanceGovernor"))
+	TArray<float> SignificanceTierTickIntervals;
+
+	/** 
+	 * @brief Ground probes all throttled characters may issue per frame. Characters over budget reuse their last result.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Significance",
+		meta=(ClampMin="0", EditCondition="bEnableSignificanceGovernor"))
+	int32 GroundProbeBudgetPerFrame{128};
+
+	/** 
+	 * @brief Distance from the location of the last probe within which an over budget character reuses its result.
+	 * Further away the probe runs regardless of the budget.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Significance",
+		meta=(ClampMin="0", Units="cm", EditCondition="bEnableSignificanceGovernor"))
+	float GroundProbeReuseDistance{10.f};
+
+	/**
+	 * @brief Gets the movement tick interval of a significance tier.
+	 * 
+	 * @param Tier The tier, 0 being full cost.
+	 * @return Tick interval in seconds.
+	 */
+	float GetTierTickInterval(uint8 Tier) const;
+};
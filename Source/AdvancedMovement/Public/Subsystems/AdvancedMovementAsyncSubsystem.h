@@ -0,0 +1,100 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AdvancedMovementAsyncSubsystem.generated.h"
+
+class FAdvancedMovementAsyncCallback;
+
+/**
+ * @class UAdvancedMovementAsyncSubsystem
+ * @brief Marshals slide work of async-physics components to a Chaos sim callback and back.
+ *
+ * The callback runs at the fixed physics rate when the project ticks physics asynchronously, otherwise it
+ * runs once per frame with the physics scene. Results arrive at least one physics step after submission and
+ * depend on the physics step timing, so they are only used for characters no client predicts.
+ */
+UCLASS()
+class ADVANCEDMOVEMENT_API UAdvancedMovementAsyncSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Queues the slide state of a component for the next physics step.
+	 * 
+	 * @param ComponentId Unique id of the submitting component.
+	 * @param Serial Serial of the slide of the component, results of other slides are discarded.
+	 * @param Velocity Velocity after the move, including its collision response.
+	 * @param Acceleration Current (strafe-projected) acceleration.
+	 * @param GravityForce Slide gravity force.
+	 * @param Friction Slide friction.
+	 * @param BrakingFriction Slide braking friction, already scaled by BrakingFrictionFactor.
+	 * @param MaxBrakingDeceleration Slide braking deceleration.
+	 * @param BrakingSubStepTime Braking substep of the component.
+	 * @param MaxSpeed Slide maximum speed.
+	 */
+	void SubmitSlide(uint32 ComponentId, uint32 Serial, const FVector& Velocity, const FVector& Acceleration, float GravityForce,
+	                 float Friction, float BrakingFriction, float MaxBrakingDeceleration, float BrakingSubStepTime,
+	                 float MaxSpeed);
+
+	/**
+	 * @brief Gets the latest slide velocity computed on the physics thread.
+	 * 
+	 * @param ComponentId Unique id of the component.
+	 * @param Serial Serial of the current slide of the component.
+	 * @param OutVelocity The velocity.
+	 * @return True if a result of this slide exists, otherwise false.
+	 */
+	bool ConsumeSlideVelocity(uint32 ComponentId, uint32 Serial, FVector& OutVelocity);
+
+	/**
+	 * @brief Drops the slide result of a component whose slide ended.
+	 * 
+	 * @param ComponentId Unique id of the component.
+	 */
+	void EndSlide(uint32 ComponentId);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * @brief Registers the sim callback with the physics solver of the world, if not done yet.
+	 * 
+	 * @return True if the callback is registered.
+	 */
+	bool EnsureCallback();
+
+	/**
+	 * @brief Pops physics outputs into the result maps, once per frame.
+	 */
+	void PullOutputs();
+
+	/** 
+	 * @brief The sim callback, owned by the solver.
+	 */
+	FAdvancedMovementAsyncCallback* AsyncCallback{nullptr};
+
+	/**
+	 * @brief Slide velocity and the serial of the slide it belongs to.
+	 */
+	struct FSlideResult
+	{
+		uint32 Serial{0};
+		FVector3f Velocity{FVector3f::ZeroVector};
+	};
+
+	/** 
+	 * @brief Latest slide result per component id.
+	 */
+	TMap<uint32, FSlideResult> SlideResults;
+
+	/** 
+	 * @brief Frame the outputs were last pulled on.
+	 */
+	uint64 LastPullFrame{0};
+};
@@ -0,0 +1,38 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Types/AdvancedMovementEventStream.h"
+#include "AdvancedMovementEventSubsystem.generated.h"
+
+/**
+ * @class UAdvancedMovementEventSubsystem
+ * @brief Owns the movement event stream of a world. Created only if UAdvancedMovementSettings::bEnableEventStream is set.
+ */
+UCLASS()
+class ADVANCEDMOVEMENT_API UAdvancedMovementEventSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Gets the event stream. Consumers may keep the pointer beyond the lifetime of the world.
+	 * 
+	 * @return The event stream of this world.
+	 */
+	TSharedPtr<FAdvancedMovementEventStream, ESPMode::ThreadSafe> GetEventStream() const { return EventStream; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** 
+	 * @brief The event stream of this world.
+	 */
+	TSharedPtr<FAdvancedMovementEventStream, ESPMode::ThreadSafe> EventStream;
+};
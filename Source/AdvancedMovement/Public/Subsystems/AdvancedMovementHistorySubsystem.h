@@ -0,0 +1,183 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AdvancedMovementHistorySubsystem.generated.h"
+
+class AAdvancedMovementCharacter;
+
+/**
+ * @brief State of one character at one point in server time.
+ */
+USTRUCT(BlueprintType)
+struct ADVANCEDMOVEMENT_API FAdvancedMovementHistorySample
+{
+	GENERATED_BODY()
+
+	/** Server time of the sample. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	double Time{0.0};
+
+	/** Location of the capsule. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	FVector Location{FVector::ZeroVector};
+
+	/** Rotation of the capsule. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	FQuat Rotation{FQuat::Identity};
+
+	/** Scaled capsule radius. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	float CapsuleRadius{0.f};
+
+	/** Scaled capsule half height. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	float CapsuleHalfHeight{0.f};
+
+	/** Movement mode. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	TEnumAsByte<EMovementMode> MovementMode{MOVE_None};
+
+	/** Custom movement mode, see ECustomMovementMode. */
+	UPROPERTY(BlueprintReadOnly, Category="AdvancedMovement|History")
+	uint8 CustomMovementMode{0};
+};
+
+/**
+ * @class UAdvancedMovementHistorySubsystem
+ * @brief Server-side lag compensation history of AAdvancedMovementCharacter.
+ *
+ * Every registered character gets a slot. Each server tick writes one frame row holding the state of all slots,
+ * stored as struct-of-arrays ring buffers indexed [Frame * SlotCapacity + Slot], so rewinding many characters to
+ * the same time reads two contiguous rows per attribute.
+ */
+UCLASS()
+class ADVANCEDMOVEMENT_API UAdvancedMovementHistorySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Starts recording a character.
+	 * 
+	 * @param InCharacter The character to record.
+	 */
+	void RegisterCharacter(AAdvancedMovementCharacter* InCharacter);
+
+	/**
+	 * @brief Stops recording a character and forgets its history.
+	 * 
+	 * @param InCharacter The character to forget.
+	 */
+	void UnregisterCharacter(AAdvancedMovementCharacter* InCharacter);
+
+	/**
+	 * @brief Gets the interpolated state of a character at a server time.
+	 * 
+	 * @param InCharacter The character to rewind.
+	 * @param ServerTime The server time, clamped to the newest recorded frame.
+	 * @param OutSample The interpolated state.
+	 * @return True if the history covers the time, otherwise false.
+	 */
+	UFUNCTION(BlueprintCallable, Category="AdvancedMovement|History")
+	bool GetSampleAtTime(const AAdvancedMovementCharacter* InCharacter, double ServerTime,
+	                     FAdvancedMovementHistorySample& OutSample) const;
+
+	/**
+	 * @brief Calls InFunction with the interpolated state of every recorded character at a server time.
+	 * 
+	 * @param ServerTime The server time, clamped to the newest recorded frame.
+	 * @param InFunction Called once per character that has history at that time.
+	 * @return The number of characters visited.
+	 */
+	int32 ForEachSampleAtTime(double ServerTime,
+	                          TFunctionRef<void(AAdvancedMovementCharacter*, const FAdvancedMovementHistorySample&)>
+	                          InFunction) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * @brief Finds the two frames around a server time.
+	 * 
+	 * @param ServerTime The server time.
+	 * @param OutFrameA The older frame.
+	 * @param OutFrameB The newer frame.
+	 * @param OutAlpha Interpolation alpha between the frames.
+	 * @return True if the history covers the time, otherwise false.
+	 */
+	bool FindFrames(double ServerTime, int32& OutFrameA, int32& OutFrameB, float& OutAlpha) const;
+
+	/**
+	 * @brief Interpolates one slot between two frames.
+	 * 
+	 * @return True if the slot has data in either frame, otherwise false.
+	 */
+	bool SampleSlot(int32 Slot, int32 FrameA, int32 FrameB, float Alpha, FAdvancedMovementHistorySample& OutSample) const;
+
+	/**
+	 * @brief Grows the slot capacity, re-laying out every frame row.
+	 * 
+	 * @param NewCapacity The new number of slots per frame.
+	 */
+	void GrowSlots(int32 NewCapacity);
+
+	/**
+	 * @brief Gets the flat index of a slot in a frame.
+	 */
+	FORCEINLINE int32 Index(int32 Frame, int32 Slot) const { return Frame * SlotCapacity + Slot; }
+
+	/** 
+	 * @brief Character of every slot, null if the slot is free.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AAdvancedMovementCharacter>> SlotCharacters;
+
+	/** 
+	 * @brief Free slot indices.
+	 */
+	TArray<int32> FreeSlots;
+
+	/** 
+	 * @brief Number of frames in the ring.
+	 */
+	int32 NumFrames{0};
+
+	/** 
+	 * @brief Number of slots per frame row.
+	 */
+	int32 SlotCapacity{0};
+
+	/** 
+	 * @brief Frame written next.
+	 */
+	int32 FrameHead{0};
+
+	/** 
+	 * @brief Number of frames written so far, up to NumFrames.
+	 */
+	int32 NumRecordedFrames{0};
+
+	/** 
+	 * @brief Server time of every frame.
+	 */
+	TArray<double> FrameTimes;
+
+	/** 
+	 * @brief Per frame and slot attributes.
+	 */
+	TArray<FVector> Locations;
+	TArray<FQuat4f> Rotations;
+	TArray<FVector2f> CapsuleSizes;
+	TArray<uint8> MovementModes;
+	TArray<uint8> CustomMovementModes;
+	TArray<uint8> ValidFlags;
+};
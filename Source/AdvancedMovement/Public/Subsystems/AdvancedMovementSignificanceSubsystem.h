@@ -0,0 +1,74 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AdvancedMovementSignificanceSubsystem.generated.h"
+
+class UAdvancedMovementComponent;
+
+/**
+ * @class UAdvancedMovementSignificanceSubsystem
+ * @brief Dedicated server governor that assigns AI characters a significance tier by distance to players.
+ *
+ * Tier 0 is full cost. Higher tiers tick movement at a longer interval, skip the post-move slide probe and take
+ * their ground probes from a per-frame budget shared by all throttled characters. Player-controlled characters
+ * always stay in tier 0. Enabled with UAdvancedMovementSettings::bEnableSignificanceGovernor.
+ */
+UCLASS()
+class ADVANCEDMOVEMENT_API UAdvancedMovementSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * @brief Starts governing a movement component.
+	 * 
+	 * @param InComponent The component to govern.
+	 */
+	void RegisterComponent(UAdvancedMovementComponent* InComponent);
+
+	/**
+	 * @brief Stops governing a movement component.
+	 * 
+	 * @param InComponent The component to release.
+	 */
+	void UnregisterComponent(UAdvancedMovementComponent* InComponent);
+
+	/**
+	 * @brief Takes one ground probe from this frame's shared budget.
+	 * 
+	 * @return True if the probe may be issued, false if the caller should reuse its last result.
+	 */
+	bool TryConsumeGroundProbe();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/**
+	 * @brief Recomputes the tier of every governed component.
+	 */
+	void UpdateTiers();
+
+	/** 
+	 * @brief Governed components.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAdvancedMovementComponent>> Components;
+
+	/** 
+	 * @brief Ground probes left in the current frame.
+	 */
+	int32 GroundProbesLeft{0};
+
+	/** 
+	 * @brief Seconds until the next tier update.
+	 */
+	float TimeUntilTierUpdate{0.f};
+};
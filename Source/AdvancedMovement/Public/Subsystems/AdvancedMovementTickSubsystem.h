@@ -0,0 +1,127 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AdvancedMovementTickSubsystem.generated.h"
+
+class AController;
+class UAdvancedMovementComponent;
+class UAdvancedMovementTickSubsystem;
+
+/**
+ * @brief Single tick function that drives every batched UAdvancedMovementComponent of a world.
+ */
+USTRUCT()
+struct FAdvancedMovementBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/** 
+	 * @brief The subsystem that owns this tick function.
+	 */
+	UAdvancedMovementTickSubsystem* Subsystem{nullptr};
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FAdvancedMovementBatchTickFunction> : public TStructOpsTypeTraitsBase2<
+		FAdvancedMovementBatchTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * @class UAdvancedMovementTickSubsystem
+ * @brief Opt-in world subsystem that ticks all registered movement components from one tick function.
+ *
+ * Components that enable bUseBatchedTick register here on BeginPlay. Their own tick functions (and, optionally,
+ * the owning actor tick) are disabled, and the subsystem walks them in registration order every frame.
+ */
+UCLASS()
+class ADVANCEDMOVEMENT_API UAdvancedMovementTickSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Adds a movement component to the batch and disables its own tick function. The character mesh
+	 * ticks after the batch, as it would after the movement tick.
+	 * 
+	 * @param InComponent The component to register.
+	 */
+	void RegisterComponent(UAdvancedMovementComponent* InComponent);
+
+	/**
+	 * @brief Removes a movement component from the batch and the batch prerequisite of its character mesh.
+	 * 
+	 * @param InComponent The component to unregister.
+	 */
+	void UnregisterComponent(UAdvancedMovementComponent* InComponent);
+
+	/**
+	 * @brief Makes the batch tick wait for the given controller, like AController::AddPawnTickDependency does
+	 * for per-component ticks.
+	 * 
+	 * @param InController The controller of a batched pawn.
+	 */
+	void AddControllerPrerequisite(AController* InController);
+
+	/**
+	 * @brief Removes a prerequisite added with AddControllerPrerequisite.
+	 * 
+	 * @param InController The previous controller of a batched pawn.
+	 */
+	void RemoveControllerPrerequisite(AController* InController);
+
+	/**
+	 * @brief Ticks every registered component. Called by the batch tick function.
+	 * 
+	 * @param DeltaTime The world delta time.
+	 * @param TickType The kind of tick.
+	 */
+	void TickComponents(float DeltaTime, ELevelTick TickType);
+
+	/**
+	 * @brief Gets the number of batched components.
+	 * 
+	 * @return The number of registered components, including stale entries not compacted yet.
+	 */
+	int32 GetNumComponents() const { return Components.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** 
+	 * @brief The tick function shared by all batched components.
+	 */
+	FAdvancedMovementBatchTickFunction BatchTickFunction;
+
+	/** 
+	 * @brief Batched components in registration order. Unregistered slots are nulled and compacted on the next tick.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAdvancedMovementComponent>> Components;
+
+	/** 
+	 * @brief Time accumulated by each component since its last tick, parallel to Components.
+	 * Lets components with a tick interval skip frames like their own tick function would.
+	 */
+	TArray<float> AccumulatedTimes;
+
+	/** 
+	 * @brief True if Components contains null slots.
+	 */
+	bool bHasStaleEntries{false};
+};
@@ -0,0 +1,68 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCurveFloat;
+
+/**
+ * @brief A curve sampled at evenly spaced times over its key range, evaluated by one lookup and lerp.
+ *
+ * Baked once when the tuning is applied, so per-move code and replays never evaluate the curve itself.
+ * Times outside the key range clamp to the first or last sample.
+ */
+struct ADVANCEDMOVEMENT_API FAdvancedMovementBakedCurve
+{
+	/** Number of samples taken from a curve. */
+	static constexpr int32 NumSamples = 32;
+
+	/**
+	 * @brief Samples a curve.
+	 * 
+	 * @param InCurve The curve, may be null.
+	 * @param InDefaultValue Value returned by Evaluate if the curve is null.
+	 */
+	void Bake(const UCurveFloat* InCurve, float InDefaultValue);
+
+	/**
+	 * @brief Evaluates the baked curve.
+	 * 
+	 * @param InTime The curve time.
+	 * @return The interpolated sample, or the default value if no curve is baked.
+	 */
+	float Evaluate(float InTime) const
+	{
+		if (!bBaked)
+		{
+			return DefaultValue;
+		}
+
+		const float position = FMath::Clamp((InTime - MinTime) * InvSampleStep, 0.f, static_cast<float>(NumSamples - 1));
+		const int32 index = FMath::Min(static_cast<int32>(position), NumSamples - 2);
+		return FMath::Lerp(Samples[index], Samples[index + 1], position - index);
+	}
+
+	/**
+	 * @brief Checks if a curve is baked.
+	 * 
+	 * @return True if a curve is baked, otherwise false.
+	 */
+	bool IsBaked() const { return bBaked; }
+
+private:
+	/** Curve values at evenly spaced times. */
+	float Samples[NumSamples]{};
+
+	/** Time of the first sample. */
+	float MinTime{0.f};
+
+	/** Inverse of the time between two samples, zero for a single-key curve. */
+	float InvSampleStep{0.f};
+
+	/** Value used without a curve. */
+	float DefaultValue{0.f};
+
+	/** True if Samples holds a curve. */
+	bool bBaked{false};
+};
@@ -0,0 +1,64 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types/AdvancedMovementFeatures.h"
+
+/**
+ * @brief Per-character movement cost and network counters, recorded if ADVANCEDMOVEMENT_WITH_DEBUG_STATS is set.
+ *
+ * Per-frame values are rolled over lazily by the first record of a new frame, so moves received through server
+ * RPCs are counted in the frame they were performed in.
+ */
+struct ADVANCEDMOVEMENT_API FAdvancedMovementDebugStats
+{
+	/** Number of correction times kept. */
+	static constexpr int32 MaxCorrectionTimes = 32;
+
+	/** Frame the "this frame" values belong to. */
+	uint64 Frame{0};
+
+	/** Cycles spent in PerformMovement this frame. */
+	uint64 MovementCyclesThisFrame{0};
+
+	/** Milliseconds spent in PerformMovement in the last completed frame. */
+	float MovementMsLastFrame{0.f};
+
+	/** Ground traces issued this frame. */
+	int32 TracesThisFrame{0};
+
+	/** Ground traces issued in the last completed frame. */
+	int32 TracesLastFrame{0};
+
+	/** Dash requests rejected since the character spawned. */
+	int32 RejectedDashes{0};
+
+	/** Corrections sent or received since the character spawned. */
+	int32 NumCorrections{0};
+
+	/** World times of the most recent corrections, a ring indexed by NumCorrections. */
+	double CorrectionTimes[MaxCorrectionTimes]{};
+
+	/**
+	 * @brief Rolls the per-frame values over if InFrame is a new frame.
+	 * 
+	 * @param InFrame The current frame counter.
+	 */
+	void BeginFrame(uint64 InFrame);
+
+	/**
+	 * @brief Records a correction.
+	 * 
+	 * @param InWorldTime World time of the correction.
+	 */
+	void AddCorrection(double InWorldTime);
+
+	/**
+	 * @brief Counts the recorded corrections newer than a world time, up to MaxCorrectionTimes.
+	 * 
+	 * @param InWorldTime The oldest world time to count.
+	 * @return The number of corrections.
+	 */
+	int32 CountCorrectionsSince(double InWorldTime) const;
+};
@@ -0,0 +1,111 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * @brief Kinds of events published to FAdvancedMovementEventStream.
+ */
+enum class EAdvancedMovementEventType : uint8
+{
+	SlideEnter, /**< Entered CMOVE_Slide. */
+	SlideExit, /**< Left CMOVE_Slide. */
+	DashStart, /**< Dash performed, Payload is the dash direction. */
+	DashRejected, /**< Dash requested but not allowed. */
+	SprintStart, /**< Started sprinting. */
+	SprintStop /**< Stopped sprinting. */
+};
+
+/**
+ * @brief Compact movement event, safe to copy to any thread.
+ */
+struct FAdvancedMovementEvent
+{
+	/** World time the event was produced at. */
+	double WorldTime{0.0};
+
+	/** Location of the updated component when the event was produced. */
+	FVector3f Location{FVector3f::ZeroVector};
+
+	/** UObject unique id of the producing UAdvancedMovementComponent. */
+	uint32 ComponentId{0};
+
+	/** The kind of event. */
+	EAdvancedMovementEventType Type{EAdvancedMovementEventType::SlideEnter};
+
+	/** Type-specific data, e.g. the dash direction. */
+	uint8 Payload{0};
+};
+
+/**
+ * @class FAdvancedMovementEventStream
+ * @brief Fixed-size single-producer ring buffer of movement events.
+ *
+ * The game thread pushes, any thread drains in batches. Neither side blocks: a full buffer drops new events
+ * and a drain that overlaps another drain returns nothing.
+ */
+class ADVANCEDMOVEMENT_API FAdvancedMovementEventStream
+{
+public:
+	/**
+	 * @brief Creates a stream.
+	 * 
+	 * @param InCapacity The requested capacity, rounded up to a power of two.
+	 */
+	explicit FAdvancedMovementEventStream(uint32 InCapacity);
+
+	FAdvancedMovementEventStream(const FAdvancedMovementEventStream&) = delete;
+	FAdvancedMovementEventStream& operator=(const FAdvancedMovementEventStream&) = delete;
+
+	/**
+	 * @brief Publishes an event. Producer side, game thread only.
+	 * 
+	 * @param InEvent The event to publish.
+	 * @return True if the event was stored, false if the buffer was full.
+	 */
+	bool Push(const FAdvancedMovementEvent& InEvent);
+
+	/**
+	 * @brief Moves pending events into OutEvents. Safe to call from any thread.
+	 * 
+	 * @param OutEvents Array the events are appended to.
+	 * @param MaxEvents The maximum number of events to drain.
+	 * @return The number of drained events.
+	 */
+	int32 Drain(TArray<FAdvancedMovementEvent>& OutEvents, int32 MaxEvents = MAX_int32);
+
+	/**
+	 * @brief Gets the number of events dropped because the buffer was full.
+	 * 
+	 * @return The number of dropped events.
+	 */
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Gets the capacity of the buffer.
+	 * 
+	 * @return The number of events the buffer can hold.
+	 */
+	uint32 GetCapacity() const { return Mask + 1; }
+
+private:
+	/** Event storage, sized to a power of two. */
+	TArray<FAdvancedMovementEvent> Buffer;
+
+	/** Capacity - 1. */
+	uint32 Mask;
+
+	/** Next write index, owned by the producer. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Head{0};
+
+	/** Next read index, owned by the draining consumer. */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Tail{0};
+
+	/** Set while a consumer drains. */
+	std::atomic<bool> bDraining{false};
+
+	/** Events dropped because the buffer was full. */
+	std::atomic<uint64> NumDropped{0};
+};
@@ -0,0 +1,49 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Compile-time ability switches of UAdvancedMovementComponent. All default to 1; a project that does not use an
+ * ability defines it to 0 for every module, e.g. GlobalDefinitions.Add("ADVANCEDMOVEMENT_WITH_DASH=0") in its
+ * Target.cs. A disabled ability keeps its reflected members so assets and Blueprints keep loading, but its traces,
+ * checks and replication are compiled out.
+ */
+#ifndef ADVANCEDMOVEMENT_WITH_SPRINT
+#define ADVANCEDMOVEMENT_WITH_SPRINT 1
+#endif
+
+#ifndef ADVANCEDMOVEMENT_WITH_SLIDE
+#define ADVANCEDMOVEMENT_WITH_SLIDE 1
+#endif
+
+#ifndef ADVANCEDMOVEMENT_WITH_DASH
+#define ADVANCEDMOVEMENT_WITH_DASH 1
+#endif
+
+/** Per-character cost and network counters shown by the gameplay debugger, off in shipping builds by default. */
+#ifndef ADVANCEDMOVEMENT_WITH_DEBUG_STATS
+#define ADVANCEDMOVEMENT_WITH_DEBUG_STATS !UE_BUILD_SHIPPING
+#endif
+
+#if ADVANCEDMOVEMENT_WITH_DEBUG_STATS
+#define ADVANCEDMOVEMENT_DEBUG_STAT(Expr) Expr
+#else
+#define ADVANCEDMOVEMENT_DEBUG_STAT(Expr)
+#endif
+
+/**
+ * @brief Feature policy of UAdvancedMovementComponent, used with if constexpr so disabled branches emit no code.
+ */
+struct FAdvancedMovementFeatures
+{
+	/** True if sprinting is compiled in. */
+	static constexpr bool bWithSprint = ADVANCEDMOVEMENT_WITH_SPRINT != 0;
+
+	/** True if sliding is compiled in. */
+	static constexpr bool bWithSlide = ADVANCEDMOVEMENT_WITH_SLIDE != 0;
+
+	/** True if dashing is compiled in. */
+	static constexpr bool bWithDash = ADVANCEDMOVEMENT_WITH_DASH != 0;
+};
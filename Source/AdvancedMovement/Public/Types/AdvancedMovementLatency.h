@@ -0,0 +1,113 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/** Input-to-effect latency recording, on wherever the CSV profiler is compiled in. */
+#ifndef ADVANCEDMOVEMENT_WITH_LATENCY_STATS
+#define ADVANCEDMOVEMENT_WITH_LATENCY_STATS CSV_PROFILER
+#endif
+
+/**
+ * @brief Inputs whose latency to the simulated effect is measured.
+ */
+enum class EAdvancedMovementInput : uint8
+{
+	Sprint, /**< SprintPressed until GetMaxSpeed returns the sprint speed. */
+	Slide, /**< SlidePressed until entering CMOVE_Slide. */
+	Dash, /**< DashPressed until PerformDash. */
+	MAX
+};
+
+/**
+ * @brief Latency histogram with fixed millisecond buckets.
+ */
+struct ADVANCEDMOVEMENT_API FAdvancedMovementLatencyHistogram
+{
+	/** Number of buckets, the last one is unbounded. */
+	static constexpr int32 NumBuckets = 10;
+
+	/** Inclusive upper bound of each bounded bucket, in milliseconds. */
+	static constexpr float BucketUpperMs[NumBuckets - 1] = {8.f, 16.f, 33.f, 50.f, 66.f, 100.f, 150.f, 250.f, 500.f};
+
+	/** Samples per bucket. */
+	uint32 Counts[NumBuckets]{};
+
+	/** Number of samples. */
+	uint32 NumSamples{0};
+
+	/** Sum of all samples, in milliseconds. */
+	double TotalMs{0.0};
+
+	/** Largest sample, in milliseconds. */
+	float MaxMs{0.f};
+
+	/**
+	 * @brief Adds a sample.
+	 * 
+	 * @param InMs The latency in milliseconds.
+	 */
+	void Add(float InMs);
+
+	/**
+	 * @brief Removes all samples.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Formats the histogram as "count avg max | bucket:count ...".
+	 * 
+	 * @return The formatted histogram.
+	 */
+	FString ToString() const;
+};
+
+/**
+ * @brief Process-wide latency histograms of all movement components, game thread only.
+ *
+ * Every sample is also written as a CSV custom stat, and the histograms are written to the CSV metadata when a
+ * capture ends.
+ */
+class ADVANCEDMOVEMENT_API FAdvancedMovementLatencyStats
+{
+public:
+	/**
+	 * @brief Gets the histograms.
+	 * 
+	 * @return The process-wide instance.
+	 */
+	static FAdvancedMovementLatencyStats& Get();
+
+	/**
+	 * @brief Records a latency sample.
+	 * 
+	 * @param InInput The input the latency belongs to.
+	 * @param bInServer True if measured on the server in client move time, false if measured on the owning client.
+	 * @param InMs The latency in milliseconds.
+	 */
+	void AddSample(EAdvancedMovementInput InInput, bool bInServer, float InMs);
+
+	/**
+	 * @brief Gets a histogram.
+	 * 
+	 * @param InInput The input.
+	 * @param bInServer True for the server histogram, false for the client one.
+	 * @return The histogram.
+	 */
+	const FAdvancedMovementLatencyHistogram& GetHistogram(EAdvancedMovementInput InInput, bool bInServer) const;
+
+	/**
+	 * @brief Removes all samples, called when a CSV capture starts.
+	 */
+	void Reset();
+
+	/**
+	 * @brief Writes all histograms to the CSV metadata, called when a CSV capture ends.
+	 */
+	void WriteCsvMetadata() const;
+
+private:
+	FAdvancedMovementLatencyHistogram Histograms[2][static_cast<uint8>(EAdvancedMovementInput::MAX)];
+};
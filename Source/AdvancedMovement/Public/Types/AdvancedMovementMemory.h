@@ -0,0 +1,16 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Low-Level Memory tracker tags of the plugin, shown as AdvancedMovement and its children in LLM reports.
+ * Everything the plugin allocates outside of the engine's own character movement falls under one of them.
+ */
+LLM_DECLARE_TAG_API(AdvancedMovement, ADVANCEDMOVEMENT_API);
+LLM_DECLARE_TAG_API(AdvancedMovement_Prediction, ADVANCEDMOVEMENT_API);
+LLM_DECLARE_TAG_API(AdvancedMovement_SavedMoves, ADVANCEDMOVEMENT_API);
+LLM_DECLARE_TAG_API(AdvancedMovement_QueryParams, ADVANCEDMOVEMENT_API);
+LLM_DECLARE_TAG_API(AdvancedMovement_Delegates, ADVANCEDMOVEMENT_API);
@@ -0,0 +1,114 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/** Saved move and ServerMove counters, on wherever the CSV profiler is compiled in. */
+#ifndef ADVANCEDMOVEMENT_WITH_NET_STATS
+#define ADVANCEDMOVEMENT_WITH_NET_STATS CSV_PROFILER
+#endif
+
+#if ADVANCEDMOVEMENT_WITH_NET_STATS
+#define ADVANCEDMOVEMENT_NET_STAT(Expr) Expr
+#else
+#define ADVANCEDMOVEMENT_NET_STAT(Expr)
+#endif
+
+/**
+ * @brief Reasons a saved move could not be combined with the pending move.
+ */
+enum class EAdvancedMovementCombineRefusal : uint8
+{
+	Sprint, /**< Sprint input changed. */
+	Slide, /**< Slide input changed. */
+	Dash, /**< Dash input changed. */
+	Stamina, /**< Stamina ran out or came back. */
+	DashCooldown, /**< A dash is buffered during its cooldown. */
+	Base, /**< Refused by FSavedMove_Character, e.g. acceleration, rotation or movement mode changed. */
+	MAX
+};
+
+/**
+ * @brief Per-character saved move and ServerMove counters since the character spawned.
+ *
+ * Moves are created, combined, sent and acknowledged on the owning client, and dropped on the server. Every record
+ * is also accumulated into a CSV custom stat of the frame, summed over all characters of the process.
+ */
+struct ADVANCEDMOVEMENT_API FAdvancedMovementNetStats
+{
+	/** Saved moves created. */
+	uint32 MovesCreated{0};
+
+	/** Saved moves combined into the pending move. */
+	uint32 MovesCombined{0};
+
+	/** New and pending moves sent to the server, without redundant old moves. */
+	uint32 MovesSent{0};
+
+	/** Saved moves acknowledged by the server. */
+	uint32 MovesAcked{0};
+
+	/** Moves the server dropped for an invalid time stamp, resends of processed moves are not counted. */
+	uint32 MovesDropped{0};
+
+	/** Refused combines by reason. */
+	uint32 CombineRefusals[static_cast<uint8>(EAdvancedMovementCombineRefusal::MAX)]{};
+
+	/** ServerMovePacked RPCs sent. */
+	uint32 ServerMovePackets{0};
+
+	/** Bytes of move data sent in ServerMovePacked RPCs. */
+	uint64 ServerMoveBytes{0};
+
+	/**
+	 * @brief Records a created saved move.
+	 */
+	void RecordCreated();
+
+	/**
+	 * @brief Records a saved move combined into the pending move.
+	 */
+	void RecordCombined();
+
+	/**
+	 * @brief Records a refused combine.
+	 * 
+	 * @param InReason The first reason the combine was refused for.
+	 */
+	void RecordRefusal(EAdvancedMovementCombineRefusal InReason);
+
+	/**
+	 * @brief Records moves sent to the server.
+	 * 
+	 * @param InNumMoves The number of new and pending moves sent.
+	 */
+	void RecordSent(int32 InNumMoves);
+
+	/**
+	 * @brief Records a ServerMovePacked RPC.
+	 * 
+	 * @param InBytes The size of its move data.
+	 */
+	void RecordServerMovePacket(int32 InBytes);
+
+	/**
+	 * @brief Records moves acknowledged by the server.
+	 * 
+	 * @param InNumMoves The number of saved moves acknowledged.
+	 */
+	void RecordAcked(int32 InNumMoves);
+
+	/**
+	 * @brief Records a move dropped by the server.
+	 */
+	void RecordDropped();
+
+	/**
+	 * @brief Gets the average ServerMovePacked size.
+	 * 
+	 * @return The average size in bytes, 0 if nothing was sent.
+	 */
+	float GetAverageServerMoveBytes() const;
+};
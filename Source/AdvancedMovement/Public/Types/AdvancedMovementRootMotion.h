@@ -0,0 +1,67 @@
+﻿// © Artem Podorozhko. All Rights Reserved. This project, including all associated assets, code, and content, is the property of Artem Podorozhko. Unauthorized use, distribution, or modification is strictly prohibited.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/RootMotionSource.h"
+#include "AdvancedMovementRootMotion.generated.h"
+
+class UCurveFloat;
+
+/**
+ * @brief Shape of a root motion dash in one direction.
+ */
+USTRUCT(BlueprintType)
+struct ADVANCEDMOVEMENT_API FAdvancedDashRootMotionParams
+{
+	GENERATED_BODY()
+
+	/** 
+	 * @brief Duration of the dash in seconds.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, meta=(ClampMin="0.01", Units="s"))
+	float Duration{0.2f};
+
+	/** 
+	 * @brief Dash speed multiplier over the normalized dash time (0..1). Constant speed if not set.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditDefaultsOnly)
+	TObjectPtr<UCurveFloat> StrengthOverTime{nullptr};
+};
+
+/**
+ * @brief Constant force root motion source of a dash.
+ *
+ * Predicted, saved and replayed by the CharacterMovementComponent root motion machinery, so the dash no longer
+ * depends on frame timing. Serializes a quantized force and the dash direction instead of a full precision vector.
+ */
+USTRUCT()
+struct ADVANCEDMOVEMENT_API FRootMotionSource_AdvancedDash : public FRootMotionSource_ConstantForce
+{
+	GENERATED_BODY()
+
+	FRootMotionSource_AdvancedDash();
+
+	/** 
+	 * @brief Direction of the dash, see UAdvancedMovementComponent::EDashDirection.
+	 */
+	UPROPERTY()
+	uint8 DashDirection{0};
+
+	virtual FRootMotionSource* Clone() const override;
+	virtual bool Matches(const FRootMotionSource* Other) const override;
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+	virtual UScriptStruct* GetScriptStruct() const override;
+	virtual FString ToSimpleString() const override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FRootMotionSource_AdvancedDash> : public TStructOpsTypeTraitsBase2<
+		FRootMotionSource_AdvancedDash>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};